@@ -0,0 +1,54 @@
+#!/bin/sh
+#
+# bootcheck.sh -- the bundle updater of src/boot.c must write a new
+#                 asset bundle, changed pages only
+#
+# Usage:
+#   ./bootcheck.sh
+#
+# Builds the firmware with ASSET_BUNDLE=1 SAMPLES_LZ=1 of clips made
+# by tools/sfxgen.py in a scratch copy of src/, then a bundle of
+# another coin clip, an audio only update. fedorsim resets into the
+# updater with button 0 held, tools/bundleflash.py sends the bundle
+# over the pty, the flash saved at the end must hold it at
+# BUNDLE_ADDR. Needs simavr with self-programming of the m16.
+#
+
+set -e
+
+SECONDS_RUN=10
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'kill $SIM 2>/dev/null; rm -rf "$TMP"' EXIT
+
+make -s -C "$ROOT/sim"
+cp -r "$ROOT/src" "$TMP/src"
+cp -r "$ROOT/tools" "$TMP/tools"
+cd "$TMP"
+
+tools/sfxgen.py -o theme.raw 262:200 330:200 392:200 523:200 392:200 \
+	330:200 262:200 196:200 >/dev/null
+tools/sfxgen.py -o coin.raw 988:80 1319:112 >/dev/null
+tools/sfxgen.py -o coin2.raw 784:80 1047:112 >/dev/null
+CLIPS="theme=$TMP/theme.raw,loop phrase=$TMP/theme.raw@6400+6400,loop \
+	intro=$TMP/theme.raw@0+3200"
+
+make -s -C src clean
+make -s -C src ASSET_BUNDLE=1 SAMPLES_LZ=1 \
+	BUNDLE_CLIPS="$CLIPS coin=$TMP/coin.raw" >/dev/null
+make -s -C src boot.elf
+tools/mkbundle.py -o new.bin -H new.h -z $CLIPS coin=coin2.raw 2>/dev/null
+
+"$ROOT/sim/fedorsim" -t $SECONDS_RUN -u -b src/boot.elf -w flash.bin \
+	-p 0@0 src/fedordesk.elf > sim.out &
+SIM=$!
+while ! grep -q '^uart: ' sim.out; do
+	sleep 0.1
+done
+tools/bundleflash.py "$(sed -n 's/^uart: //p' sim.out)" new.bin
+wait $SIM
+
+ADDR=$(($(sed -n 's/^BUNDLE_ADDR=//p' src/Makefile)))
+cmp -i $ADDR:0 -n "$(wc -c < new.bin)" flash.bin new.bin
+cmp -s src/bundle.bin new.bin && echo "bundles are the same" && exit 1
+echo "bundle is in flash at $ADDR"
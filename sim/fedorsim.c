@@ -0,0 +1,523 @@
+/*
+ * fedorsim -- run FedorDesk firmware under simavr
+ *
+ * Usage:
+ *   fedorsim [-t SECONDS] [-f FLASH.BIN] [-e EEPROM.BIN] [-o AUDIO.RAW]
+ *            [-p BUTTON@MS]... [-u] [-r] [-i] [-l] [-b BOOT.ELF]
+ *            [-w FLASH.BIN] fedordesk.elf
+ *
+ *   -t  simulated time, seconds (default 5)
+ *   -f  attach 25-series serial flash model with this image
+ *   -e  EEPROM content, loaded if the file exists and saved back at
+ *       the end, e.g. to keep tools/ledupload.py uploads
+ *   -o  record speaker PWM duty at 8kHz as raw 8-bit unsigned pcm,
+ *       listen with: aplay -f U8 -r 8000 AUDIO.RAW
+ *   -p  press button 0..2 at MS milliseconds of simulated time
+ *   -u  bridge USART to a pseudo terminal, its name is printed,
+ *       e.g. for tools/uartplay.py, implies -r
+ *   -r  do not run faster than real time
+ *   -i  measure the sample ISR, firmware built with ISR_PROBE=1
+ *   -l  print changes of the led frame shown by src/leds.c with the
+ *       time, ms, matrix leds only
+ *   -b  load the bundle updater of src/boot.c to its boot section and
+ *       reset into it, e.g. -b boot.elf -p 0@0 -u for
+ *       tools/bundleflash.py
+ *   -w  save the whole flash at the end, e.g. to compare a bundle
+ *       written by the updater, see bootcheck.sh
+ *
+ * The .assets section of ASSET_BUNDLE=1 is loaded to flash as well.
+ *
+ * At the end firmware counters found in the elf are printed, and
+ * how much of the painted stack area was never touched, see
+ * src/stack.h.
+ */
+
+#include <fcntl.h>
+#include <gelf.h>
+#include <libelf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_irq.h"
+#include "sim_cycle_timers.h"
+#include "avr_ioport.h"
+#include "avr_eeprom.h"
+
+#include "flash25.h"
+#include "uartpty.h"
+
+#define MMCU        "atmega16"
+#define F_CPU       8000000
+#define SAMPLE_RATE 8000
+
+// ATmega16 data space addresses (I/O + 0x20)
+#define ADDR_OCR2   0x43
+#define ADDR_TCCR2  0x45
+#define RAMEND      0x45f
+
+// src/stack.h
+#define STACK_CANARY 0xc5
+
+// AVR elf puts data space at this offset
+#define ELF_DATA    0x800000
+
+#define EEPROM_SIZE 512
+
+#define PRESSES_MAX 32
+#define PRESS_MS    20
+
+// led frame is polled this often, us
+#define LEDS_POLL_US 100
+#define LEDS_FRAME_MAX 16
+
+typedef struct press {
+	uint8_t button;
+	uint32_t ms;
+} press_t;
+
+typedef struct probe {
+	avr_cycle_count_t start;
+	uint64_t total;
+	uint32_t max;
+	uint32_t count;
+} probe_t;
+
+static avr_t* s_avr;
+static FILE* s_audio;
+static probe_t s_probe;
+static press_t s_presses[PRESSES_MAX];
+static int s_presses_num;
+static uint32_t s_leds_addr;
+static uint32_t s_leds_front;
+static uint32_t s_leds_buf;
+static uint32_t s_leds_size;
+static uint8_t s_leds_frame[LEDS_FRAME_MAX];
+
+// BUTTON[0..2] -> PD2, PD3, PB2
+static avr_irq_t* button_irq(uint8_t b)
+{
+	static const struct {
+		char port;
+		uint8_t pin;
+	} pins[] = { { 'D', 2 }, { 'D', 3 }, { 'B', 2 } };
+
+	return avr_io_getirq(s_avr, AVR_IOCTL_IOPORT_GETIRQ(pins[b].port),
+						 pins[b].pin);
+}
+
+static avr_cycle_count_t release_button(avr_t* avr, avr_cycle_count_t when,
+										void* param)
+{
+	avr_raise_irq(button_irq((uintptr_t)param), 1);
+	return 0;
+}
+
+static avr_cycle_count_t press_button(avr_t* avr, avr_cycle_count_t when,
+									  void* param)
+{
+	uintptr_t b = (uintptr_t)param;
+
+	// falling edge fires INTx
+	avr_raise_irq(button_irq(b), 0);
+	avr_cycle_timer_register_usec(avr, PRESS_MS * 1000, release_button, param);
+	return 0;
+}
+
+static avr_cycle_count_t record_sample(avr_t* avr, avr_cycle_count_t when,
+									   void* param)
+{
+	// gated PWM keeps speaker pin low
+	uint8_t s = (avr->data[ADDR_TCCR2] & 0x07) ? avr->data[ADDR_OCR2] : 0;
+
+	fputc(s, s_audio);
+	return when + F_CPU / SAMPLE_RATE;
+}
+
+// PD6 is high while the sample ISR runs, firmware built with ISR_PROBE=1
+static void probe_pin(avr_irq_t* irq, uint32_t value, void* param)
+{
+	uint32_t cycles;
+
+	if (value) {
+		s_probe.start = s_avr->cycle;
+		return;
+	}
+	if (!s_probe.start)
+		return;
+	cycles = s_avr->cycle - s_probe.start;
+	s_probe.total += cycles;
+	if (cycles > s_probe.max)
+		s_probe.max = cycles;
+	s_probe.count++;
+	s_probe.start = 0;
+}
+
+static int elf_symbol(const char* path, const char* name, uint32_t* addr,
+					  uint32_t* size)
+{
+	Elf_Scn* scn = NULL;
+	Elf* e;
+	int fd, found = 0;
+
+	elf_version(EV_CURRENT);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 0;
+	e = elf_begin(fd, ELF_C_READ, NULL);
+
+	while (!found && e && (scn = elf_nextscn(e, scn))) {
+		GElf_Shdr sh;
+		Elf_Data* data;
+
+		if (!gelf_getshdr(scn, &sh) || sh.sh_type != SHT_SYMTAB)
+			continue;
+		data = elf_getdata(scn, NULL);
+		for (size_t i = 0; data && i < sh.sh_size / sh.sh_entsize; ++i) {
+			GElf_Sym sym;
+
+			gelf_getsym(data, i, &sym);
+			if (!strcmp(elf_strptr(e, sh.sh_link, sym.st_name), name)) {
+				*addr = sym.st_value - ELF_DATA;
+				if (size)
+					*size = sym.st_size;
+				found = 1;
+				break;
+			}
+		}
+	}
+	if (e)
+		elf_end(e);
+	close(fd);
+
+	return found;
+}
+
+// flash section simavr doesn't load, 0 if there is none, addr is
+// where it went
+static int elf_load_section(const char* path, const char* name,
+							uint32_t* addr)
+{
+	Elf_Scn* scn = NULL;
+	Elf* e;
+	size_t shstrndx;
+	int fd, found = 0;
+
+	elf_version(EV_CURRENT);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 0;
+	e = elf_begin(fd, ELF_C_READ, NULL);
+
+	while (!found && e && !elf_getshdrstrndx(e, &shstrndx) &&
+		   (scn = elf_nextscn(e, scn))) {
+		GElf_Shdr sh;
+		Elf_Data* data;
+
+		if (!gelf_getshdr(scn, &sh) ||
+			strcmp(elf_strptr(e, shstrndx, sh.sh_name), name))
+			continue;
+		data = elf_getdata(scn, NULL);
+		if (data && sh.sh_addr + data->d_size <= s_avr->flashend + 1u) {
+			memcpy(s_avr->flash + sh.sh_addr, data->d_buf, data->d_size);
+			if (addr)
+				*addr = sh.sh_addr;
+			found = 1;
+		}
+		break;
+	}
+	if (e)
+		elf_end(e);
+	close(fd);
+
+	return found;
+}
+
+static void print_counter(const char* elf, const char* name)
+{
+	uint32_t addr;
+
+	if (!elf_symbol(elf, name, &addr, NULL))
+		return;
+	printf("%-16s %u\n", name,
+		   s_avr->data[addr] | (s_avr->data[addr + 1] << 8));
+}
+
+static void print_stack(const char* elf)
+{
+	uint32_t end, p;
+
+	if (!elf_symbol(elf, "_end", &end, NULL))
+		return;
+	for (p = end; p <= RAMEND && s_avr->data[p] == STACK_CANARY; ++p)
+		;
+	printf("stack free       %u (reached 0x%03x)\n", p - end, p);
+}
+
+// layer words of the front frame, printed when they change
+static avr_cycle_count_t poll_leds(avr_t* avr, avr_cycle_count_t when,
+								   void* param)
+{
+	const uint8_t* frame = avr->data + s_leds_addr +
+		avr->data[s_leds_front] * s_leds_buf;
+
+	if (memcmp(frame, s_leds_frame, s_leds_size)) {
+		memcpy(s_leds_frame, frame, s_leds_size);
+		printf("leds %10.3f ", (double)when * 1000 / F_CPU);
+		for (uint32_t i = 0; i < s_leds_size; i += 2)
+			printf(" %04x", frame[i] | (frame[i + 1] << 8));
+		printf("\n");
+	}
+	return when + F_CPU / 1000000 * LEDS_POLL_US;
+}
+
+static double now()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// sleep while simulated time is ahead of wall clock
+static avr_cycle_count_t realtime(avr_t* avr, avr_cycle_count_t when,
+								  void* param)
+{
+	static double s_start;
+	double ahead;
+
+	if (!s_start)
+		s_start = now();
+	ahead = (double)when / F_CPU - (now() - s_start);
+	if (ahead > 0)
+		usleep(ahead * 1e6);
+
+	return when + F_CPU / 1000;
+}
+
+static void eeprom_load(const char* path)
+{
+	uint8_t ee[EEPROM_SIZE];
+	avr_eeprom_desc_t desc = { .ee = ee, .offset = 0, .size = sizeof(ee) };
+	FILE* f = fopen(path, "rb");
+
+	// new file is erased EEPROM
+	memset(ee, 0xff, sizeof(ee));
+	if (f) {
+		if (fread(ee, 1, sizeof(ee), f) == 0)
+			fprintf(stderr, "%s: empty, EEPROM is erased\n", path);
+		fclose(f);
+	}
+	avr_ioctl(s_avr, AVR_IOCTL_EEPROM_SET, &desc);
+}
+
+static void eeprom_save(const char* path)
+{
+	uint8_t ee[EEPROM_SIZE];
+	avr_eeprom_desc_t desc = { .ee = ee, .offset = 0, .size = sizeof(ee) };
+	FILE* f;
+
+	if (avr_ioctl(s_avr, AVR_IOCTL_EEPROM_GET, &desc))
+		return;
+	f = fopen(path, "wb");
+	if (!f) {
+		perror(path);
+		return;
+	}
+	fwrite(ee, 1, sizeof(ee), f);
+	fclose(f);
+}
+
+static void flash_save(const char* path)
+{
+	FILE* f = fopen(path, "wb");
+
+	if (!f) {
+		perror(path);
+		return;
+	}
+	fwrite(s_avr->flash, 1, s_avr->flashend + 1, f);
+	fclose(f);
+}
+
+static void usage(const char* prog)
+{
+	fprintf(stderr, "Usage: %s [-t SECONDS] [-f FLASH.BIN] [-e EEPROM.BIN] "
+			"[-o AUDIO.RAW] [-p BUTTON@MS]... [-u] [-r] [-i] [-l] [-b BOOT.ELF] "
+			"[-w FLASH.BIN] fedordesk.elf\n",
+			prog);
+	exit(1);
+}
+
+int main(int argc, char** argv)
+{
+	elf_firmware_t fw = { { 0 } };
+	flash25_t flash;
+	uartpty_t uart;
+	const char* flash_image = NULL;
+	const char* eeprom_image = NULL;
+	const char* boot_elf = NULL;
+	const char* flash_dump = NULL;
+	int use_uart = 0, use_realtime = 0, use_probe = 0, use_leds = 0;
+	double seconds = 5;
+	int opt, state;
+
+	while ((opt = getopt(argc, argv, "t:f:e:o:p:urilb:w:")) != -1) {
+		switch (opt) {
+		case 't':
+			seconds = atof(optarg);
+			break;
+		case 'f':
+			flash_image = optarg;
+			break;
+		case 'e':
+			eeprom_image = optarg;
+			break;
+		case 'o':
+			s_audio = fopen(optarg, "wb");
+			if (!s_audio) {
+				perror(optarg);
+				return 1;
+			}
+			break;
+		case 'p': {
+			unsigned b, ms;
+
+			if (s_presses_num == PRESSES_MAX ||
+				sscanf(optarg, "%u@%u", &b, &ms) != 2 || b > 2)
+				usage(argv[0]);
+			s_presses[s_presses_num].button = b;
+			s_presses[s_presses_num].ms = ms;
+			s_presses_num++;
+			break;
+		}
+		case 'u':
+			use_uart = 1;
+			use_realtime = 1;
+			break;
+		case 'r':
+			use_realtime = 1;
+			break;
+		case 'i':
+			use_probe = 1;
+			break;
+		case 'l':
+			use_leds = 1;
+			break;
+		case 'b':
+			boot_elf = optarg;
+			break;
+		case 'w':
+			flash_dump = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1)
+		usage(argv[0]);
+
+	if (elf_read_firmware(argv[optind], &fw)) {
+		fprintf(stderr, "%s: can't read firmware\n", argv[optind]);
+		return 1;
+	}
+	s_avr = avr_make_mcu_by_name(MMCU);
+	if (!s_avr) {
+		fprintf(stderr, "simavr has no %s\n", MMCU);
+		return 1;
+	}
+	avr_init(s_avr);
+	fw.frequency = F_CPU;
+	avr_load_firmware(s_avr, &fw);
+	elf_load_section(argv[optind], ".assets", NULL);
+	if (boot_elf) {
+		uint32_t boot;
+
+		// as BOOTRST does
+		if (!elf_load_section(boot_elf, ".text", &boot)) {
+			fprintf(stderr, "%s: can't load updater\n", boot_elf);
+			return 1;
+		}
+		s_avr->pc = s_avr->reset_pc = boot;
+	}
+	if (eeprom_image)
+		eeprom_load(eeprom_image);
+
+	// buttons are pulled up on the board
+	for (uint8_t b = 0; b < 3; ++b)
+		avr_raise_irq(button_irq(b), 1);
+	for (int i = 0; i < s_presses_num; ++i)
+		avr_cycle_timer_register_usec(s_avr, s_presses[i].ms * 1000,
+									  press_button,
+									  (void*)(uintptr_t)s_presses[i].button);
+
+	if (flash_image) {
+		if (flash25_init(&flash, flash_image, 4 << 20))
+			return 1;
+		flash25_connect(&flash, s_avr);
+	}
+	if (use_uart) {
+		if (uartpty_init(&uart, s_avr))
+			return 1;
+		printf("uart: %s\n", uart.name);
+		fflush(stdout);
+	}
+	if (use_probe)
+		avr_irq_register_notify(
+			avr_io_getirq(s_avr, AVR_IOCTL_IOPORT_GETIRQ('D'), IOPORT_IRQ_PIN6),
+			probe_pin, NULL);
+	if (use_leds) {
+		// two leds_buf_t of LAYERS_NUM words, bytes and 3 more bytes,
+		// charlieplexed ones keep port slots only
+		if (!elf_symbol(argv[optind], "s_bufs", &s_leds_addr, &s_leds_buf) ||
+			!elf_symbol(argv[optind], "s_front", &s_leds_front, NULL)) {
+			fprintf(stderr, "%s: no led frame\n", argv[optind]);
+			return 1;
+		}
+		s_leds_buf /= 2;
+		s_leds_size = (s_leds_buf - 3) / 3 * 2;
+		if (!s_leds_size || s_leds_size > LEDS_FRAME_MAX) {
+			fprintf(stderr, "%s: no led frame\n", argv[optind]);
+			return 1;
+		}
+		avr_cycle_timer_register_usec(s_avr, LEDS_POLL_US, poll_leds, NULL);
+	}
+	if (use_realtime)
+		avr_cycle_timer_register(s_avr, F_CPU / 1000, realtime, NULL);
+	if (s_audio)
+		avr_cycle_timer_register(s_avr, F_CPU / SAMPLE_RATE,
+								 record_sample, NULL);
+
+	do {
+		state = avr_run(s_avr);
+	} while (state != cpu_Done && state != cpu_Crashed &&
+			 s_avr->cycle < (avr_cycle_count_t)(seconds * F_CPU));
+
+	printf("cycles           %llu\n", (unsigned long long)s_avr->cycle);
+	if (flash_image)
+		printf("flash reads      %u (%llu bytes)\n", flash.reads,
+			   (unsigned long long)flash.bytes);
+	if (use_uart)
+		printf("uart rx/tx       %u/%u bytes\n", uart.rx_bytes, uart.tx_bytes);
+	if (use_probe && s_probe.count)
+		printf("sample ISR       %llu avg, %u max cycles of %u (%u runs)\n",
+			   (unsigned long long)(s_probe.total / s_probe.count),
+			   s_probe.max, F_CPU / SAMPLE_RATE, s_probe.count);
+	print_counter(argv[optind], "s_underruns");
+	print_counter(argv[optind], "s_rx_underruns");
+	print_counter(argv[optind], "s_rx_overruns");
+	print_stack(argv[optind]);
+
+	if (s_audio)
+		fclose(s_audio);
+	if (eeprom_image)
+		eeprom_save(eeprom_image);
+	if (flash_dump)
+		flash_save(flash_dump);
+
+	return state == cpu_Crashed;
+}
@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "avr_spi.h"
+#include "avr_ioport.h"
+
+#include "flash25.h"
+
+#define CMD_READ      0x03
+#define CMD_FAST_READ 0x0b
+#define CMD_RDSR      0x05
+#define CMD_JEDEC_ID  0x9f
+
+// Winbond W25Q32, 4MB
+#define DEFAULT_ID    0xef4016
+
+int flash25_init(flash25_t* p, const char* image, uint32_t size)
+{
+	FILE* f;
+	long len;
+
+	memset(p, 0, sizeof(*p));
+	p->id = DEFAULT_ID;
+
+	f = fopen(image, "rb");
+	if (!f) {
+		perror(image);
+		return -1;
+	}
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	p->size = (uint32_t)len > size ? (uint32_t)len : size;
+	p->data = malloc(p->size);
+	if (!p->data) {
+		fclose(f);
+		return -1;
+	}
+	// erased flash reads as 0xff
+	memset(p->data, 0xff, p->size);
+	if (fread(p->data, 1, len, f) != (size_t)len) {
+		perror(image);
+		fclose(f);
+		return -1;
+	}
+	fclose(f);
+
+	return 0;
+}
+
+// byte shifted in while the MCU shifts out 'in'
+static uint8_t flash25_xfer(flash25_t* p, uint8_t in)
+{
+	uint8_t n = p->count++;
+
+	if (n == 0) {
+		p->cmd = in;
+		p->addr = 0;
+		if (p->cmd == CMD_READ || p->cmd == CMD_FAST_READ)
+			p->reads++;
+		return 0xff;
+	}
+
+	switch (p->cmd) {
+	case CMD_READ:
+	case CMD_FAST_READ:
+		if (n <= 3) {
+			p->addr = (p->addr << 8) | in;
+			return 0xff;
+		}
+		// fast read has one dummy byte after address
+		if (p->cmd == CMD_FAST_READ && n == 4)
+			return 0xff;
+		p->bytes++;
+		return p->data[p->addr++ % p->size];
+	case CMD_JEDEC_ID:
+		if (n > 3)
+			return 0xff;
+		return p->id >> (8 * (3 - n));
+	case CMD_RDSR:
+		// never busy
+		return 0x00;
+	default:
+		return 0xff;
+	}
+}
+
+static void flash25_spi_hook(struct avr_irq_t* irq, uint32_t value, void* param)
+{
+	flash25_t* p = param;
+
+	if (!p->selected)
+		return;
+	avr_raise_irq(p->spi_in, flash25_xfer(p, value));
+}
+
+static void flash25_cs_hook(struct avr_irq_t* irq, uint32_t value, void* param)
+{
+	flash25_t* p = param;
+
+	// active low, new command on every select
+	p->selected = !value;
+	p->count = 0;
+}
+
+void flash25_connect(flash25_t* p, avr_t* avr)
+{
+	p->spi_in = avr_io_getirq(avr, AVR_IOCTL_SPI_GETIRQ(0), SPI_IRQ_INPUT);
+
+	avr_irq_register_notify(
+		avr_io_getirq(avr, AVR_IOCTL_SPI_GETIRQ(0), SPI_IRQ_OUTPUT),
+		flash25_spi_hook, p);
+	avr_irq_register_notify(
+		avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('B'), IOPORT_IRQ_PIN4),
+		flash25_cs_hook, p);
+}
@@ -0,0 +1,32 @@
+#ifndef FLASH25_H
+#define FLASH25_H
+
+#include <stdint.h>
+
+#include "sim_avr.h"
+
+/*
+ * Software model of a 25-series serial flash (read side only),
+ * hooked to the ATmega16 hardware SPI, CS is PB4.
+ */
+
+typedef struct flash25 {
+	uint8_t* data;
+	uint32_t size;
+	uint32_t id;
+
+	avr_irq_t* spi_in;
+	uint8_t selected;
+	uint8_t cmd;
+	uint8_t count;
+	uint32_t addr;
+
+	// statistics
+	uint32_t reads;
+	uint64_t bytes;
+} flash25_t;
+
+int flash25_init(flash25_t* p, const char* image, uint32_t size);
+void flash25_connect(flash25_t* p, avr_t* avr);
+
+#endif //FLASH25_H
@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# ledbench.sh -- sample ISR cost against led matrix size
+#
+# Usage:
+#   ./ledbench.sh [SECONDS]
+#
+# Builds the firmware with ISR_PROBE=1 for every geometry below in
+# a scratch copy of src/, runs it in fedorsim with a mode on, so
+# leds are refreshed, and prints the ISR cycles measured on PD6.
+# The budget is F_CPU / SAMPLE_RATE = 1000 cycles.
+#
+# Geometry: name, then column and layer pins, or -x and charlieplexed
+# pins with -n geometry. PD6 is the probe pin.
+#
+
+set -e
+
+SECONDS_RUN=${1:-2}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+make -s -C "$ROOT/sim"
+cp -r "$ROOT/src" "$ROOT/tools" "$TMP"
+
+bench() {
+	name=$1
+	shift
+
+	if [ "$1" = -x ]; then
+		"$TMP/tools/ledmap.py" -o "$TMP/src/ledmap.h" "$@" 2>/dev/null
+	else
+		"$TMP/tools/ledmap.py" -o "$TMP/src/ledmap.h" -c "$1" -l "$2" \
+			2>/dev/null
+	fi
+	make -s -C "$TMP/src" clean
+	make -s -C "$TMP/src" ISR_PROBE=1 >/dev/null
+	printf '%-6s ' "$name"
+	"$ROOT/sim/fedorsim" -t "$SECONDS_RUN" -p 2@10 -i "$TMP/src/fedordesk.elf" |
+		sed -n 's/^sample ISR *//p'
+}
+
+bench 12x3 PA0-7,PC0-3 PC4-6
+bench 16x3 PA0-7,PC0-7 PB0-1,PB3
+bench 16x4 PA0-7,PC0-7 PB0-1,PB3,PD4
+bench 16x8 PA0-7,PC0-7 PB0-1,PB3,PD4-5,PB4-6
+bench c12x3 -x PA0-6 -n 12x3
+bench c16x3 -x PA0-7 -n 16x3
@@ -0,0 +1,40 @@
+#!/bin/sh
+#
+# samplecheck.sh -- naked sample ISR must play what the C mixer does
+#
+# Usage:
+#   ./samplecheck.sh [SECONDS]
+#
+# Builds the firmware with and without SAMPLE_ASM=1 in scratch
+# copies of src/, runs both in fedorsim with the same presses and
+# compares the PWM samples byte by byte. Presses start the theme
+# with the press effect on top, speed it up, switch to another theme,
+# then stop it, so the naked path is armed, loops the theme and is
+# taken back by the C mixer several times.
+#
+
+set -e
+
+SECONDS_RUN=${1:-8}
+PRESSES="-p 0@100 -p 0@1500 -p 1@3000 -p 1@4200 -p 1@5000 -p 1@5800"
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+make -s -C "$ROOT/sim"
+cp -r "$ROOT/tools" "$TMP/tools"
+
+for mode in 0 1; do
+	cp -r "$ROOT/src" "$TMP/src$mode"
+	make -s -C "$TMP/src$mode" clean
+	make -s -C "$TMP/src$mode" SAMPLE_ASM=$mode ISR_PROBE=1 >/dev/null
+	echo "SAMPLE_ASM=$mode"
+	"$ROOT/sim/fedorsim" -t "$SECONDS_RUN" $PRESSES -i -o "$TMP/out$mode.raw" \
+		"$TMP/src$mode/fedordesk.elf" | grep -e '^sample ISR' -e underruns || true
+done
+
+if cmp "$TMP/out0.raw" "$TMP/out1.raw"; then
+	echo "identical, $(wc -c < "$TMP/out0.raw") samples"
+else
+	exit 1
+fi
@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# spectrumbench.sh -- cycles of the spectrum bands and how many of
+#                     them keep up with 8kHz playback
+#
+# Usage:
+#   ./spectrumbench.sh [SECONDS]
+#
+# Builds the firmware with SPECTRUM=1 in scratch copies of src/, runs
+# it in fedorsim with button 0 pressed, i.e. the spectrum shows its
+# theme, and measures on PD6:
+#   ISR_PROBE=1  the sample ISR, spectrum_put() included
+#   ISR_PROBE=2  a decimated sample through all bands
+# Per band cost is the latter over the band count. Max bands is what
+# one decimated sample period leaves after the sample ISRs, over the
+# per band cost, i.e. with nothing else in the main loop.
+#
+
+set -e
+
+SECONDS_RUN=${1:-3}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+BANDS=$(sed -n 's/^#define LEDS_NUM *\([0-9]*\).*/\1/p' "$ROOT/src/ledmap.h")
+DECIMATE=$(sed -n 's/^#define SPECTRUM_DECIMATE *\([0-9]*\).*/\1/p' \
+	"$ROOT/src/spectrum.h")
+
+make -s -C "$ROOT/sim"
+cp -r "$ROOT/tools" "$TMP/tools"
+
+for probe in 1 2; do
+	cp -r "$ROOT/src" "$TMP/src$probe"
+	make -s -C "$TMP/src$probe" clean
+	make -s -C "$TMP/src$probe" SPECTRUM=1 ISR_PROBE=$probe >/dev/null
+	"$ROOT/sim/fedorsim" -t "$SECONDS_RUN" -p 0@100 -i \
+		"$TMP/src$probe/fedordesk.elf" |
+		sed -n 's/^sample ISR *\([0-9]*\) avg, \([0-9]*\) max.*/\1 \2/p' \
+		> "$TMP/probe$probe"
+done
+
+read isr isr_max < "$TMP/probe1"
+read bands bands_max < "$TMP/probe2"
+awk -v isr=$isr -v isr_max=$isr_max -v all=$bands -v all_max=$bands_max \
+	-v n=$BANDS -v d=$DECIMATE 'BEGIN {
+	period = 1000 * d
+	band = all / n
+	printf "sample ISR       %d avg, %d max cycles of 1000\n", isr, isr_max
+	printf "%2d bands         %d avg, %d max cycles per sample\n", n, all, all_max
+	printf "per band         %.1f cycles\n", band
+	printf "max bands        %d at 8kHz, %d cycles per %d samples left\n",
+		(period - d * isr) / band, period - d * isr, d
+	printf "main loop load   %.0f%%\n", 100 * all / (period - d * isr)
+}'
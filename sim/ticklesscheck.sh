@@ -0,0 +1,59 @@
+#!/bin/sh
+#
+# ticklesscheck.sh -- tickless idle must keep led timing, with far
+#                     fewer sample ISR wakeups
+#
+# Usage:
+#   ./ticklesscheck.sh [SECONDS]
+#
+# Builds the firmware with and without TICKLESS=1 in scratch copies
+# of src/, runs both in fedorsim with one press of button 2, whose
+# intro clip plays once while the animation goes on silent, prints
+# the sample ISR runs, i.e. wakeups, and compares led frame changes.
+# Frames of the tickless build may come later by the ISR latency,
+# below TOLERANCE_MS.
+#
+
+set -e
+
+SECONDS_RUN=${1:-10}
+TOLERANCE_MS=0.2
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+make -s -C "$ROOT/sim"
+cp -r "$ROOT/tools" "$TMP/tools"
+
+for mode in 0 1; do
+	cp -r "$ROOT/src" "$TMP/src$mode"
+	make -s -C "$TMP/src$mode" clean
+	make -s -C "$TMP/src$mode" TICKLESS=$mode ISR_PROBE=1 >/dev/null
+	"$ROOT/sim/fedorsim" -t "$SECONDS_RUN" -p 2@100 -i -l \
+		"$TMP/src$mode/fedordesk.elf" > "$TMP/out$mode"
+	printf 'TICKLESS=%d ' $mode
+	sed -n 's/^sample ISR *//p' "$TMP/out$mode"
+	grep '^leds' "$TMP/out$mode" > "$TMP/leds$mode"
+done
+
+paste "$TMP/leds0" "$TMP/leds1" | awk -v tol=$TOLERANCE_MS '
+	{
+		n = NF / 2
+		for (i = 3; i <= n; ++i)
+			if ($i != $(n + i)) {
+				print "frame " NR " differs: " $0
+				bad = 1
+			}
+		d = $(n + 2) - $2
+		if (d < 0) d = -d
+		if (d > max) max = d
+		if (d > tol) {
+			print "frame " NR " is " d " ms off"
+			bad = 1
+		}
+	}
+	END {
+		printf "%d frames, %.3f ms max skew\n", NR, max
+		exit bad
+	}'
+[ "$(wc -l < "$TMP/leds0")" -eq "$(wc -l < "$TMP/leds1")" ]
@@ -0,0 +1,97 @@
+#include <fcntl.h>
+#include <pty.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "sim_io.h"
+#include "sim_time.h"
+#include "sim_cycle_timers.h"
+#include "avr_uart.h"
+
+#include "uartpty.h"
+
+#define XON  0x11
+#define XOFF 0x13
+
+// one byte time at 250000 baud
+#define POLL_USEC 40
+
+static void uartpty_tx_hook(struct avr_irq_t* irq, uint32_t value, void* param)
+{
+	uartpty_t* p = param;
+	uint8_t b = value;
+
+	if (b == XOFF)
+		p->fw_xon = 0;
+	else if (b == XON)
+		p->fw_xon = 1;
+
+	p->tx_bytes++;
+	if (write(p->master, &b, 1) != 1) {
+		// nobody listens, drop
+	}
+}
+
+static void uartpty_xon_hook(struct avr_irq_t* irq, uint32_t value, void* param)
+{
+	((uartpty_t*)param)->avr_xon = 1;
+}
+
+static void uartpty_xoff_hook(struct avr_irq_t* irq, uint32_t value, void* param)
+{
+	((uartpty_t*)param)->avr_xon = 0;
+}
+
+static avr_cycle_count_t uartpty_poll(avr_t* avr, avr_cycle_count_t when,
+									  void* param)
+{
+	uartpty_t* p = param;
+	uint8_t b;
+
+	if (p->avr_xon && p->fw_xon && read(p->master, &b, 1) == 1) {
+		p->rx_bytes++;
+		avr_raise_irq(p->uart_in, b);
+	}
+	return when + avr_usec_to_cycles(avr, POLL_USEC);
+}
+
+int uartpty_init(uartpty_t* p, avr_t* avr)
+{
+	struct termios t;
+	uint32_t flags = 0;
+
+	memset(p, 0, sizeof(*p));
+	p->avr_xon = 1;
+	p->fw_xon = 1;
+
+	if (openpty(&p->master, &p->slave, p->name, NULL, NULL)) {
+		perror("openpty");
+		return -1;
+	}
+	// binary, keep slave open so master never sees EIO
+	tcgetattr(p->slave, &t);
+	cfmakeraw(&t);
+	tcsetattr(p->slave, TCSANOW, &t);
+	fcntl(p->master, F_SETFL, fcntl(p->master, F_GETFL) | O_NONBLOCK);
+
+	// do not echo firmware output to stdout
+	avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &flags);
+	flags &= ~AVR_UART_FLAG_STDIO;
+	avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &flags);
+
+	p->uart_in = avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_INPUT);
+	avr_irq_register_notify(
+		avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT),
+		uartpty_tx_hook, p);
+	avr_irq_register_notify(
+		avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUT_XON),
+		uartpty_xon_hook, p);
+	avr_irq_register_notify(
+		avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUT_XOFF),
+		uartpty_xoff_hook, p);
+	avr_cycle_timer_register_usec(avr, POLL_USEC, uartpty_poll, p);
+
+	return 0;
+}
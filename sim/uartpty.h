@@ -0,0 +1,31 @@
+#ifndef UARTPTY_H
+#define UARTPTY_H
+
+#include <stdint.h>
+
+#include "sim_avr.h"
+
+/*
+ * USART0 bridged to a pseudo terminal, host tools open the slave
+ * side (name) as a serial port. Like a USB serial adapter with
+ * flow control, bytes are fed to the MCU only while the firmware
+ * has not sent XOFF.
+ */
+
+typedef struct uartpty {
+	int master;
+	int slave;
+	char name[64];
+
+	avr_irq_t* uart_in;
+	uint8_t avr_xon;   // simavr rx fifo has room
+	uint8_t fw_xon;    // firmware flow control
+
+	// statistics
+	uint32_t rx_bytes;
+	uint32_t tx_bytes;
+} uartpty_t;
+
+int uartpty_init(uartpty_t* p, avr_t* avr);
+
+#endif //UARTPTY_H
@@ -0,0 +1,182 @@
+#include <avr/io.h>
+#include <avr/boot.h>
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
+#include <util/delay.h>
+
+#include "uart.h"
+#include "upload.h"
+
+/*
+ * Asset bundle updater, a program of its own in the boot section at
+ * BOOT_ADDR, see Makefile, tools/bundleflash.py talks to it.
+ *
+ * Holding button 0 at reset enters it, otherwise the application
+ * starts at once. Frames are those of upload.h, addr is from
+ * BUNDLE_ADDR and page aligned, payload is up to a page:
+ *
+ *   'H'  hello, ACK
+ *   'C'  ACK, then crc[2], CRC-XMODEM of the flash page at addr
+ *   'P'  payload is the page at addr, erased and written only if
+ *        it differs, ACK when it reads back the same
+ *   'G'  ACK, then the application starts
+ *
+ * Pages out of [BUNDLE_ADDR, BUNDLE_END) are NAKed, code is never
+ * written. An interrupted update leaves a bundle of a bad CRC, which
+ * the application doesn't play, see bundle.h, and is sent again.
+ * No interrupts are used, vectors stay in the application section.
+ */
+
+#define SYNC    'F'
+#define HEADER  5 // sync, cmd, addr, len
+#define CRC     2
+
+// button 0, INT0, see main.c
+#define BUTTON_PIN PIND
+#define BUTTON_BIT PD2
+
+static uint8_t s_frame[HEADER + SPM_PAGESIZE + CRC];
+
+static uint8_t rx()
+{
+	while (!(UCSRA & (1 << RXC)))
+		;
+	return UDR;
+}
+
+static void tx(uint8_t b)
+{
+	while (!(UCSRA & (1 << UDRE)))
+		;
+	UDR = b;
+}
+
+// 0 if it is broken or too long, resyncs on the next 'F'
+static uint8_t receive()
+{
+	uint16_t crc = 0;
+	uint8_t i, len;
+
+	while (rx() != SYNC)
+		;
+	for (i = 1; i < HEADER; ++i)
+		s_frame[i] = rx();
+	len = s_frame[4];
+	if (len > SPM_PAGESIZE)
+		return 0;
+	for (i = 0; i < len + CRC; ++i)
+		s_frame[HEADER + i] = rx();
+
+	for (i = 1; i < HEADER + len; ++i)
+		crc = _crc_xmodem_update(crc, s_frame[i]);
+	return crc == (s_frame[HEADER + len] | (s_frame[HEADER + len + 1] << 8));
+}
+
+static uint16_t page_crc(uint16_t page)
+{
+	uint16_t crc = 0;
+	uint8_t i;
+
+	for (i = 0; i < SPM_PAGESIZE; ++i)
+		crc = _crc_xmodem_update(crc, pgm_read_byte(page + i));
+	return crc;
+}
+
+static uint8_t page_same(uint16_t page, const uint8_t* data)
+{
+	uint8_t i;
+
+	for (i = 0; i < SPM_PAGESIZE; ++i)
+		if (pgm_read_byte(page + i) != data[i])
+			return 0;
+	return 1;
+}
+
+static void page_write(uint16_t page, const uint8_t* data)
+{
+	uint8_t i;
+
+	boot_page_erase(page);
+	boot_spm_busy_wait();
+	for (i = 0; i < SPM_PAGESIZE; i += 2)
+		boot_page_fill(page + i, data[i] | (data[i + 1] << 8));
+	boot_page_write(page);
+	boot_spm_busy_wait();
+	// RWW section is read back
+	boot_rww_enable();
+}
+
+// ACK, NAK or 0 if replied already
+static uint8_t execute()
+{
+	uint8_t cmd = s_frame[1];
+	uint16_t addr = s_frame[2] | (s_frame[3] << 8);
+	uint8_t len = s_frame[4];
+	const uint8_t* payload = &s_frame[HEADER];
+	uint16_t page = BUNDLE_ADDR + addr, crc;
+
+	if (cmd == 'H')
+		return ACK;
+
+	if (addr % SPM_PAGESIZE || addr >= BUNDLE_END - BUNDLE_ADDR)
+		return NAK;
+	switch (cmd) {
+	case 'C':
+		crc = page_crc(page);
+		tx(ACK);
+		tx(crc & 0xff);
+		tx(crc >> 8);
+		return 0;
+	case 'P':
+		if (len != SPM_PAGESIZE)
+			return NAK;
+		if (!page_same(page, payload))
+			page_write(page, payload);
+		return page_same(page, payload) ? ACK : NAK;
+	}
+	return NAK;
+}
+
+// frames till 'G'
+static void update()
+{
+	uint8_t r;
+
+	// as uart.c, polled
+	UCSRA = (1 << U2X);
+	UBRRH = 0;
+	UBRRL = F_CPU / (8UL * UART_BAUD) - 1;
+	UCSRC = (1 << URSEL) | (1 << UCSZ1) | (1 << UCSZ0);
+	UCSRB = (1 << RXEN) | (1 << TXEN);
+
+	for (;;) {
+		if (!receive()) {
+			tx(NAK);
+			continue;
+		}
+		if (s_frame[1] == 'G')
+			break;
+		r = execute();
+		if (r)
+			tx(r);
+	}
+
+	// ACK is out before the application takes USART
+	UCSRA = (1 << U2X) | (1 << TXC);
+	tx(ACK);
+	while (!(UCSRA & (1 << TXC)))
+		;
+	UCSRB = 0;
+}
+
+int main()
+{
+	// button is pulled up on the board, the press has settled
+	_delay_ms(1);
+	if (!(BUTTON_PIN & (1 << BUTTON_BIT)))
+		update();
+
+	// application reset vector
+	((void (*)())0)();
+	return 0;
+}
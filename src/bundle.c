@@ -0,0 +1,44 @@
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
+
+#include "bundle.h"
+
+#define BUNDLE ((const uint8_t*)BUNDLE_ADDR)
+
+// 0 while the bundle is unchecked or broken
+static uint8_t s_assets_num;
+
+uint8_t bundle_init()
+{
+	bundle_header_t h;
+	uint16_t crc = 0, i;
+
+	s_assets_num = 0;
+	memcpy_P(&h, BUNDLE, sizeof(h));
+	if (h.magic != BUNDLE_MAGIC || h.version != BUNDLE_VERSION ||
+		h.size > BUNDLE_END - BUNDLE_ADDR ||
+		h.size < sizeof(h) + h.assets_num * sizeof(asset_t))
+		return 0;
+
+	for (i = sizeof(h); i < h.size; ++i)
+		crc = _crc_xmodem_update(crc, pgm_read_byte(&BUNDLE[i]));
+	if (crc != h.crc)
+		return 0;
+
+	s_assets_num = h.assets_num;
+	return 1;
+}
+
+uint8_t bundle_asset(uint8_t id, uint8_t type, asset_t* a)
+{
+	if (id >= s_assets_num)
+		return 0;
+	memcpy_P(a, BUNDLE + sizeof(bundle_header_t) + id * sizeof(asset_t),
+			 sizeof(*a));
+	return a->type == type;
+}
+
+const uint8_t* bundle_data(const asset_t* a)
+{
+	return BUNDLE + a->offset;
+}
@@ -0,0 +1,76 @@
+#ifndef BUNDLE_H
+#define BUNDLE_H
+
+#include <avr/io.h>
+
+/*
+ * Flash asset bundle, ASSET_BUNDLE=1, built by tools/mkbundle.py and
+ * linked as the .assets section at BUNDLE_ADDR, see Makefile:
+ *
+ *   0x00  "FDAB"
+ *   0x04  version
+ *   0x05  assets number
+ *   0x06  bundle size
+ *   0x08  crc, CRC-XMODEM of the bundle after the header
+ *   0x0a  asset_t[assets number], the asset id is the index
+ *
+ * then asset data, pcm starts on a flash page. Offsets are from the
+ * bundle start, so a bundle of other content and size up to
+ * BUNDLE_END can take its place, the firmware checks it at boot.
+ *
+ * The sound bank of sound.h is the samples pool, raw or packed as
+ * of lz.h with its seek table first, and the clip, cue and beat
+ * tables. Led patterns have the layout of built-in ones.
+ */
+
+#define BUNDLE_MAGIC   0x42414446 // "FDAB"
+#define BUNDLE_VERSION 1
+
+// asset ids
+#define ASSET_SAMPLES  0
+#define ASSET_CLIPS    1
+#define ASSET_CUES     2
+#define ASSET_BEATS    3
+#define ASSET_PATTERN0 4 // one per button
+#define ASSETS_NUM     7
+
+// asset types
+enum {
+	asset_none = 0,
+	asset_pcm,
+	asset_table,
+	asset_pattern
+};
+
+// asset codecs
+enum {
+	codec_raw = 0,
+	codec_lz
+};
+
+typedef struct bundle_header {
+	uint32_t magic;
+	uint8_t  version;
+	uint8_t  assets_num;
+	uint16_t size;
+	uint16_t crc;
+} bundle_header_t;
+
+typedef struct asset {
+	uint8_t  type;
+	uint8_t  codec;
+	uint16_t rate;   // pcm, hz
+	uint16_t offset; // from the bundle start
+	uint16_t size;   // bytes in the bundle
+	uint16_t length; // unpacked bytes
+} asset_t;
+
+// CRC of the whole bundle, ~30ms, 0 if it is broken
+uint8_t bundle_init();
+// index entry of an asset, constant time, safe to call from ISR,
+// 0 if the bundle is broken, the asset is missing or of other type
+uint8_t bundle_asset(uint8_t id, uint8_t type, asset_t* a);
+// flash address of asset data
+const uint8_t* bundle_data(const asset_t* a);
+
+#endif //BUNDLE_H
@@ -1,139 +1,432 @@
+#include <stdint.h>
 #include <string.h>
+#include <avr/pgmspace.h>
 
+#include "bundle.h"
 #include "fedordesk.h"
+#include "nvm.h"
+#include "spectrum.h"
+#include "telemetry.h"
+
+// pattern frame: layer, then leds little endian
+#define FRAME(layer, leds) (layer), ((leds) & 0xff), ((leds) >> 8)
+
+// frame of a pattern lasts 1 + beats in the layer byte, up to 32
+#define FRAME_LAYER(b) ((b) & 0x07)
+#define FRAME_BEATS(b) (((b) >> 3) + 1)
+
+/*
+ * Built-in patterns, one per button, looped. Layout is the same
+ * as of patterns uploaded to EEPROM, see nvm.h: frames number,
+ * then frames. Each frame is shown for one beat of the speed tempo
+ * unless its layer byte says more beats.
+ */
+static const uint8_t s_running_light[] PROGMEM = {
+	13,
+	FRAME(0, 0b100000000000),
+	FRAME(0, 0b010000000000),
+	FRAME(0, 0b001000000000),
+	FRAME(0, 0b000100000000),
+	FRAME(0, 0b000010000000),
+	FRAME(0, 0b000001000000),
+	FRAME(0, 0b000000100000),
+	FRAME(0, 0b000000010000),
+	FRAME(0, 0b000000001000),
+	FRAME(0, 0b000000000100),
+	FRAME(0, 0b000000000010),
+	FRAME(0, 0b000000000001),
+	FRAME(0, 0),
+};
+
+static const uint8_t s_triple_light[] PROGMEM = {
+	4,
+	FRAME(1, 0b100100100100),
+	FRAME(1, 0b010010010010),
+	FRAME(1, 0b001001001001),
+	FRAME(1, 0),
+};
+
+static const uint8_t s_layers[] PROGMEM = {
+	4,
+	FRAME(2, 0b111111111111),
+	FRAME(1, 0b111111111111),
+	FRAME(0, 0b111111111111),
+	FRAME(0, 0),
+};
+
+static const uint8_t* const s_patterns[BUTTONS_NUM] PROGMEM = {
+	s_running_light, // button0
+	s_triple_light,  // button1
+	s_layers         // button2
+};
+
+#if SPECTRUM
+// bits of band power which light the first layer at speed 0, ~21dB
+// below a full scale sine, and bits per layer, ~9dB, each speed
+// level adds a layer of gain
+#define SPECTRUM_FLOOR 15
+#define SPECTRUM_STEP  3
+#endif
+
+// beat of a tempo, Q4 ms
+#define BEAT(bpm) ((uint16_t)((uint32_t)60000 * 16 / (bpm)))
+
+// longest ms step, a beat of 30 bpm in Q4 is below INT16_MAX
+#define STEP_MS_MAX 2047
+
+// tempo of every speed level, slowest first, any bpm down to 30
+static const uint16_t s_tempos[LED_SPEEDS] PROGMEM = {
+	BEAT(120), // 500 ms
+	BEAT(200), // 300 ms
+	BEAT(600)  // 100 ms
+};
 
 static led_state_t s_leds_state;
 
 static void desk_clear_leds()
 {
 	hw_fire_leds_t cb = s_leds_state.hw_fire_leds;
+	uint8_t i;
+
 	memset(&s_leds_state, 0, sizeof(s_leds_state));
 	s_leds_state.hw_fire_leds = cb;
+	for (i = 0; i < BUTTONS_NUM; ++i)
+		s_leds_state.order[i] = button0 + i;
 }
 
-static void desk_fire_leds()
+
+/*
+ * Every animation is blended, stopped ones have no leds, so the
+ * cost is the same whatever is running. Bottom to top:
+ *   LED_BLEND=0 leds of all animations are lit
+ *   LED_BLEND=1 leds lit by two animations cancel
+ *   LED_BLEND=2 upper animation hides lower ones on its layer
+ */
+static inline void desk_blend(uint16_t* layer, uint16_t leds)
 {
-	// fire led
-	for (uint8_t y = 0; y < BUTTONS_NUM; ++y) {
-		if (s_leds_state.leds_matrix[y] != 0) {
-			s_leds_state.hw_fire_leds(&s_leds_state.leds_matrix[y], y);
-			return;
+#if LED_BLEND == 2
+	if (leds)
+		*layer = leds;
+#elif LED_BLEND == 1
+	*layer ^= leds;
+#else
+	*layer |= leds;
+#endif
+}
+
+static void desk_compose()
+{
+	uint16_t* frame = s_leds_state.frame;
+	uint8_t i;
+
+	memset(frame, 0, sizeof(s_leds_state.frame));
+	for (i = 0; i < BUTTONS_NUM; ++i) {
+		const led_anim_t* a =
+			&s_leds_state.anims[s_leds_state.order[i] - button0];
+#if SPECTRUM
+		// bars take all layers
+		if (s_leds_state.order[i] == SPECTRUM_BUTTON) {
+			uint8_t y;
+
+			for (y = 0; a->running && y < LAYERS_NUM; ++y)
+				desk_blend(&frame[y], s_leds_state.spectrum[y]);
+			continue;
 		}
+#endif
+		desk_blend(&frame[a->layer], a->leds);
+	}
+#if BEAT_MAP
+	desk_blend(&frame[s_leds_state.beat_layer], s_leds_state.beat_leds);
+#endif
+}
+
+// last running animation of order, button_unknown if none
+static button_t desk_top()
+{
+	uint8_t i = BUTTONS_NUM;
+
+	while (i--) {
+		button_t b = s_leds_state.order[i];
+		if (s_leds_state.anims[b - button0].running)
+			return b;
+	}
+	return button_unknown;
+}
+
+// move to the top of order
+static void desk_raise(button_t b)
+{
+	button_t* order = s_leds_state.order;
+	uint8_t i;
+
+	for (i = 0; order[i] != b; ++i)
+		;
+	for (; i < BUTTONS_NUM - 1; ++i)
+		order[i] = order[i + 1];
+	order[BUTTONS_NUM - 1] = b;
+}
+
+// uploaded pattern takes over the built-in one, frames number
+// is read on the first frame, EEPROM can be busy right now
+static void desk_load_pattern(led_anim_t* a, button_t b)
+{
+	uint16_t addr = nvm_pattern(b - button0);
+
+#if SPECTRUM
+	// no frames, bars are set by desk_spectrum()
+	if (b == SPECTRUM_BUTTON) {
+		memset(s_leds_state.spectrum, 0, sizeof(s_leds_state.spectrum));
+		a->wait = INT16_MAX;
+		return;
 	}
-	// turn off
-	s_leds_state.hw_fire_leds(&s_leds_state.leds_matrix[0], 0);
+#endif
+
+	a->pattern_eeprom = !!addr;
+#if ASSET_BUNDLE
+	// bundle one goes next, checked at boot
+	asset_t asset;
+
+	if (!addr && bundle_asset(ASSET_PATTERN0 + b - button0,
+							  asset_pattern, &asset))
+		addr = (uint16_t)bundle_data(&asset);
+#endif
+	if (!addr)
+		addr = pgm_read_word(&s_patterns[b - button0]);
+	a->pattern = addr;
+	a->frames_num = 0;
+	a->frame = 0;
+	// first frame goes on the next callback
+	a->wait = 0;
+	a->beats = 0;
+}
+
+static void desk_start_anim(button_t b, led_speed_t speed)
+{
+	led_anim_t* a = &s_leds_state.anims[b - button0];
+
+	a->running = 1;
+	a->speed = speed;
+	desk_load_pattern(a, b);
+	desk_raise(b);
+}
+
+static uint8_t desk_pattern_byte(const led_anim_t* a, uint16_t addr)
+{
+	if (a->pattern_eeprom)
+		return nvm_read_isr(addr);
+	return pgm_read_byte((const uint8_t*)addr);
+}
+
+// ms passed, returns 1 if a new frame is taken
+static uint8_t desk_step_anim(led_anim_t* a, uint16_t ms)
+{
+	uint8_t layer;
+
+	if (!a->running || a->speed >= LED_SPEEDS)
+		return 0;
+#if SPECTRUM
+	if (a == &s_leds_state.anims[SPECTRUM_BUTTON - button0])
+		return 0;
+#endif
+
+	// loaded pattern waits for its first frame from now on, a beat
+	// at a time, late by over INT16_MIN isn't made up, no wrap
+	if (a->frames_num) {
+		int16_t step = ms << 4;
+
+		a->wait = a->wait >= INT16_MIN + step ? a->wait - step : INT16_MIN;
+		while (a->wait <= 0 && a->beats) {
+			a->wait += pgm_read_word(&s_tempos[a->speed]);
+			--a->beats;
+		}
+		if (a->wait > 0)
+			return 0;
+	}
+
+	// EEPROM is being written, the frame is late
+	if (a->pattern_eeprom && !nvm_ready())
+		return 0;
+
+	if (!a->frames_num) {
+		a->frames_num = desk_pattern_byte(a, a->pattern);
+		if (!a->frames_num)
+			return 0;
+	}
+
+	// frames follow frames number, 3 bytes each
+	uint16_t f = a->pattern + 1 + a->frame * 3;
+
+	layer = desk_pattern_byte(a, f);
+	a->layer = FRAME_LAYER(layer) % LAYERS_NUM;
+	a->leds = desk_pattern_byte(a, f + 1) |
+		(desk_pattern_byte(a, f + 2) << 8);
+
+	// late frame is made up by its first beat, one far behind isn't
+	a->wait += pgm_read_word(&s_tempos[a->speed]);
+	if (a->wait < 0)
+		a->wait = 0;
+	a->beats = FRAME_BEATS(layer) - 1;
+
+	if (++a->frame == a->frames_num)
+		a->frame = 0;
+
+	return 1;
 }
 
 void desk_init_leds(hw_fire_leds_t cb)
 {
-	desk_clear_leds();
 	s_leds_state.hw_fire_leds = cb;
+	desk_clear_leds();
 }
 
-button_t desk_button_pressed(button_t b)
+uint8_t desk_button_pressed(button_t b, button_t* top)
 {
-	// pins jitter? ignore sequential presses in 500ms
-	if (s_leds_state.timer_counter - s_leds_state.last_pressed_ms < 5)
-		return s_leds_state.last_pressed_b;
+	led_anim_t* a = &s_leds_state.anims[b - button0];
 
-	// set timer of button press
-	s_leds_state.last_pressed_ms = s_leds_state.timer_counter;
+	if (s_leds_state.debounce)
+		return 0;
 
 	// increase speed or turn off
-	// if button is the same
-	if (s_leds_state.last_pressed_b == b) {
-		// turn off leds if speed was the last
-		if (s_leds_state.speed == led_speed2) {
-			desk_clear_leds();
-			// turn off
-			desk_fire_leds();
+	// if the button animation runs
+	if (a->running) {
+		// turn off its leds if speed was the last,
+		// others go on
+		if (a->speed == LED_SPEEDS - 1) {
+			memset(a, 0, sizeof(*a));
+			s_leds_state.stale = 1;
+#if TELEMETRY
+			tm_log(tm_mode, desk_top());
+#endif
 		}
 		// increase speed
-		else
-			++s_leds_state.speed;
+		else {
+			++a->speed;
+#if TELEMETRY
+			tm_log(tm_speed, a->speed);
+#endif
+		}
 	}
-	// change mode
+	// start its animation on top of others, first frame goes
+	// on next timer interrupt
 	else {
-		// drop leds state
-		memset(&s_leds_state.leds_matrix, 0, sizeof(s_leds_state.leds_matrix));
-		// drop to initial speed
-		s_leds_state.speed = led_speed0;
-		// init button
-		s_leds_state.last_pressed_b = b;
-
-		// drop counters to change mode on next timer interrupt
-		s_leds_state.timer_counter = 0;
-		s_leds_state.last_pressed_ms = 0;
+		desk_start_anim(b, led_speed0);
+
+#if TELEMETRY
+		tm_log(tm_mode, b);
+		tm_log(tm_speed, led_speed0);
+#endif
 	}
 
-	return s_leds_state.last_pressed_b;
+	// till desk_debounce_end()
+	s_leds_state.debounce = 1;
+
+	*top = desk_top();
+	return 1;
 }
 
-void desk_timer_100ms_callback()
+uint16_t desk_timer_callback(uint16_t ms)
 {
-	uint8_t delay;
-	switch (s_leds_state.speed) {
-	case led_speed0:
-		delay = 5; // 500 ms
-		break;
-	case led_speed1:
-		delay = 3; // 300 ms
-		break;
-	case led_speed2:
-		delay = 1; // 100 ms
-		break;
-	default:
-		// unknown state
-		return;
+	int16_t next = INT16_MAX;
+	uint8_t i, changed = 0;
+
+	// the task wakes every beat, a longer gap is far behind anyway
+	if (ms > STEP_MS_MAX)
+		ms = STEP_MS_MAX;
+
+	for (i = 0; i < BUTTONS_NUM; ++i) {
+		led_anim_t* a = &s_leds_state.anims[i];
+
+		changed |= desk_step_anim(a, ms);
+		if (a->running && a->wait < next)
+			next = a->wait;
 	}
 
-	// check delay
-	if (s_leds_state.timer_counter++ % delay != 0)
-		return;
+	// fired by the main loop
+	if (changed || s_leds_state.stale) {
+		s_leds_state.stale = 0;
+		desk_compose();
+		s_leds_state.fire = 1;
+	}
 
-	switch (s_leds_state.last_pressed_b) {
-	case button0:
-		if (s_leds_state.leds_matrix[0] == 0)
-			s_leds_state.leds_matrix[0] = (1 << (LEDS_NUM-1));
-		else
-			s_leds_state.leds_matrix[0] >>= 1;
-		break;
-	case button1:
-		if (s_leds_state.leds_matrix[1] == 0)
-			s_leds_state.leds_matrix[1] = 0b100100100100;
-		else if (s_leds_state.leds_matrix[1] & 1)
-			s_leds_state.leds_matrix[1] = 0;
-		else
-			s_leds_state.leds_matrix[1] >>= 1;
-		break;
-	case button2:
-		if (s_leds_state.leds_matrix[0] == 0 &&
-			s_leds_state.leds_matrix[1] == 0 &&
-			s_leds_state.leds_matrix[2] == 0)
-			s_leds_state.leds_matrix[2] = 0b111111111111;
-		else if (s_leds_state.leds_matrix[0] == 0 &&
-				 s_leds_state.leds_matrix[1] == 0 &&
-				 s_leds_state.leds_matrix[2] != 0) {
-			s_leds_state.leds_matrix[1] = 0b111111111111;
-			s_leds_state.leds_matrix[2] = 0;
-		}
-		else if (s_leds_state.leds_matrix[0] == 0 &&
-				 s_leds_state.leds_matrix[1] != 0 &&
-				 s_leds_state.leds_matrix[2] == 0) {
-			s_leds_state.leds_matrix[0] = 0b111111111111;
-			s_leds_state.leds_matrix[1] = 0;
-		}
-		else if (s_leds_state.leds_matrix[0] != 0 &&
-				 s_leds_state.leds_matrix[1] == 0 &&
-				 s_leds_state.leds_matrix[2] == 0) {
-			s_leds_state.leds_matrix[0] = 0;
-		}
-		break;
-	default:
-		// unknown state
+	if (next == INT16_MAX)
+		return 0;
+	// rounded up, a beat is never early, a late one retries
+	if (next < 1)
+		return 1;
+	return ((uint16_t)next + 15) >> 4;
+}
+
+#if SPECTRUM
+uint8_t desk_spectrum(const uint8_t* levels)
+{
+	const led_anim_t* a = &s_leds_state.anims[SPECTRUM_BUTTON - button0];
+	uint16_t* bars = s_leds_state.spectrum;
+	uint8_t i, y;
+
+	if (!a->running)
+		return 0;
+
+	// column per band, layers from 0 up to the level
+	memset(bars, 0, sizeof(s_leds_state.spectrum));
+	for (i = 0; i < SPECTRUM_BANDS; ++i) {
+		int8_t h = (int8_t)(levels[i] + a->speed * SPECTRUM_STEP -
+			SPECTRUM_FLOOR + SPECTRUM_STEP) / SPECTRUM_STEP;
+
+		for (y = 0; y < LAYERS_NUM && y < h; ++y)
+			bars[y] |= (uint16_t)1 << i;
+	}
+	s_leds_state.stale = 1;
+	return 1;
+}
+#endif
+
+#if BEAT_MAP
+void desk_beat(uint8_t layer, uint16_t leds)
+{
+	s_leds_state.beat_layer = layer % LAYERS_NUM;
+	s_leds_state.beat_leds = leds;
+	s_leds_state.stale = 1;
+}
+#endif
+
+void desk_fire_leds()
+{
+	// only the timer callback writes frame, the same task calls us
+	if (!s_leds_state.fire)
 		return;
+	s_leds_state.fire = 0;
+
+	// fire led, blank frame turns them off
+	s_leds_state.hw_fire_leds(s_leds_state.frame);
+}
+
+void desk_debounce_end()
+{
+	s_leds_state.debounce = 0;
+}
+
+void desk_reload_pattern()
+{
+	uint8_t i;
+
+	for (i = 0; i < BUTTONS_NUM; ++i) {
+		led_anim_t* a = &s_leds_state.anims[i];
+		if (a->running)
+			desk_load_pattern(a, button0 + i);
 	}
+}
 
-	// fire leds
-	desk_fire_leds();
+void desk_get_mode(button_t* b, led_speed_t* speed)
+{
+	*b = desk_top();
+	*speed = *b == button_unknown ? led_speed0 :
+		s_leds_state.anims[*b - button0].speed;
+}
+
+void desk_set_mode(button_t b, led_speed_t speed)
+{
+	desk_clear_leds();
+	if (b == button_unknown)
+		return;
+	desk_start_anim(b, speed);
 }
@@ -3,36 +3,110 @@
 
 #include <avr/io.h>
 
-typedef enum led_speed {
-	led_speed0 = 0,
-	led_speed1 = 1,
-	led_speed2 = 2
-} led_speed_t;
+#include "ledmap.h"
 
-typedef enum button {
+// speed levels, tempos of s_tempos in fedordesk.c, a press goes to
+// the next one, the last one turns the animation off
+#define LED_SPEEDS 3
+
+// one byte, loads and stores of it are atomic
+typedef uint8_t led_speed_t;
+#define led_speed0 0
+
+// one byte enums, loads and stores of them are atomic
+typedef enum __attribute__((packed)) button {
 	button_unknown = 0,
 	button0 = 1,
 	button1 = 2,
 	button2 = 3
 } button_t;
 
-typedef void (*hw_fire_leds_t)(const uint16_t* leds, uint8_t y);
+// LAYERS_NUM words of leds, layer 0 first
+typedef void (*hw_fire_leds_t)(const uint16_t* frame);
 
-typedef struct led_state {
+// INT0..2, LEDS_NUM and LAYERS_NUM come from ledmap.h
+#define BUTTONS_NUM 3
+
+// SPECTRUM=1, its animation shows bars of spectrum.c, speed is gain
+#define SPECTRUM_BUTTON button0
+
+// animation of one button, 13 bytes, 8 and 16-bit fields only,
+// make size-report gives s_leds_state as linked
+typedef struct led_anim {
+	uint8_t        running;
 	led_speed_t    speed;
-	button_t       last_pressed_b;
-	uint32_t       last_pressed_ms;
-	uint16_t       leds_matrix[3];
-	uint32_t       timer_counter;
+	int16_t        wait;           // Q4 ms till the next beat
+	uint8_t        beats;          // beats of the frame after it
+	// shown frame
+	uint8_t        layer;
+	uint16_t       leds;
+	// running pattern, see s_patterns in fedordesk.c
+	uint16_t       pattern;
+	uint8_t        pattern_eeprom;
+	uint8_t        frames_num;
+	uint8_t        frame;
+} led_anim_t;
+
+/*
+ * Written by the button ISRs and by the main loop tasks with
+ * interrupts disabled. Time is kept in Q4 ms by 16-bit down-counters
+ * a beat at a time, so nothing wraps and tempos drift below 1/16 ms
+ * a beat however odd it is.
+ *
+ * Every button runs its own animation, they are blended into
+ * frame when any of them takes a frame, see LED_BLEND. The last
+ * started one is on top, i.e. the last of order.
+ *
+ * Frame is composed by the timer callback only, so the main loop
+ * fires it with interrupts enabled, see desk_fire_leds(). Presses
+ * mark it stale instead.
+ */
+typedef struct led_state {
+	uint8_t        debounce;       // presses are ignored
+	uint8_t        stale;          // anims changed, frame is to compose
+	uint8_t        fire;           // frame is composed, not fired yet
+	button_t       order[BUTTONS_NUM];
+	led_anim_t     anims[BUTTONS_NUM];
+	uint16_t       frame[LAYERS_NUM];
+#if SPECTRUM
+	uint16_t       spectrum[LAYERS_NUM];
+#endif
+#if BEAT_MAP
+	// beat of the playing clip, on top of all animations
+	uint8_t        beat_layer;
+	uint16_t       beat_leds;
+#endif
 	hw_fire_leds_t hw_fire_leds;
 } led_state_t;
 
-#define LEDS_NUM    12
-#define LAYERS_NUM  3
-#define BUTTONS_NUM 3
-
 void desk_init_leds(hw_fire_leds_t cb);
-button_t desk_button_pressed(button_t b);
-void desk_timer_100ms_callback();
+// 0 if the press is ignored while debouncing, else top is the top
+// running animation, button_unknown if none is
+uint8_t desk_button_pressed(button_t b, button_t* top);
+// accepted press ignores others till this
+void desk_debounce_end();
+// ms passed since the previous call, returns ms till the next
+// frame is due, 0 if no animation runs
+uint16_t desk_timer_callback(uint16_t ms);
+// main loop, interrupts enabled, fires a frame composed by the timer
+// callback, so leds are rendered outside of critical sections
+void desk_fire_leds();
+#if SPECTRUM
+// bits of band power, see spectrum_poll(), interrupts disabled,
+// returns 1 if the frame is to compose
+uint8_t desk_spectrum(const uint8_t* levels);
+#endif
+#if BEAT_MAP
+// frame of a beat of the playing clip, leds 0 when it's dark or
+// nothing plays, interrupts disabled
+void desk_beat(uint8_t layer, uint16_t leds);
+#endif
+// uploaded patterns changed, not safe to call with interrupts enabled
+void desk_reload_pattern();
+
+// mode and speed of the top animation to save and to restore after
+// power up, not safe to call with interrupts enabled either
+void desk_get_mode(button_t* b, led_speed_t* speed);
+void desk_set_mode(button_t b, led_speed_t speed);
 
 #endif //FEDORDESK_H
@@ -0,0 +1,51 @@
+#ifndef LEDMAP_H
+#define LEDMAP_H
+
+// generated by:
+//   $ ledmap.py -o ledmap.h -c PA0-7,PC0-3 -l PC4-6
+
+#include <avr/io.h>
+
+#define LEDS_NUM    12
+#define LAYERS_NUM  3
+
+#define LEDMAP_CHARLIE 0
+
+// leds lit at a time and refresh slots to light all of them
+#define LEDS_GROUP  6
+#define LED_SLOTS   2
+
+// pins taken by leds
+#define LEDMAP_PINS_A 0xff
+#define LEDMAP_PINS_B 0x00
+#define LEDMAP_PINS_C 0x7f
+#define LEDMAP_PINS_D 0x00
+
+// columns of each refresh slot
+#define LED_SLOT_MASKS { 0x003f, 0x0fc0 }
+
+static inline void ledmap_init()
+{
+	DDRA |= 0xff;
+	DDRC |= 0x7f;
+}
+
+// columns and grounds to low
+static inline void ledmap_off()
+{
+	PORTA &= 0x00;
+	PORTC &= 0x80;
+}
+
+static inline void ledmap_columns(uint16_t leds)
+{
+	PORTA |= (uint8_t)(leds) & 0xff;
+	PORTC |= (uint8_t)(leds >> 8) & 0x0f;
+}
+
+static inline void ledmap_layer(uint8_t y)
+{
+	PORTC |= 1 << (y + 4);
+}
+
+#endif //LEDMAP_H
@@ -0,0 +1,192 @@
+#include <avr/pgmspace.h>
+
+#include "leds.h"
+#include "ledmap.h"
+
+// cycles between refresh slots for LEDS_FRAME_RATE, saturated,
+// 16-bit division is way cheaper
+static uint16_t leds_slot_period(uint8_t slots)
+{
+	if (slots == 1)
+		return 0xffff;
+	return (uint16_t)(F_CPU / LEDS_FRAME_RATE / 2) / slots * 2;
+}
+
+// frame shown by the refresh, the other one is rendered, see
+// leds_show()
+static volatile uint8_t s_front;
+// back frame is rendered, the next refresh takes it
+static volatile uint8_t s_flip;
+
+#if LEDMAP_CHARLIE
+
+typedef struct charlie_slot {
+	uint8_t ddr;
+	uint8_t port;
+} charlie_slot_t;
+
+// pins of every anode slot, refreshed in turn
+typedef struct leds_buf {
+	charlie_slot_t slots[CHARLIE_PINS];
+	uint16_t       period;
+} leds_buf_t;
+
+static const uint8_t s_anodes[CHARLIE_PINS] PROGMEM = CHARLIE_ANODES;
+static const uint8_t s_charlie_leds[LAYERS_NUM][LEDS_NUM] PROGMEM = CHARLIE_LEDS;
+
+static leds_buf_t s_bufs[2];
+static uint8_t s_slot;
+
+void leds_init()
+{
+	ledmap_init();
+}
+
+/*
+ * Slots are built once per frame, so the refresh only copies a
+ * DDR/PORT pair. Every slot takes its turn even if it is dark: each
+ * led is lit 1/CHARLIE_PINS of the time whatever else is lit, i.e.
+ * brightness doesn't change with the pattern.
+ */
+void leds_show(const uint16_t* frame)
+{
+	leds_buf_t* buf;
+	uint8_t i, y;
+
+	// refresh keeps the front, the back is ours till the flip
+	s_flip = 0;
+	buf = &s_bufs[s_front ^ 1];
+
+	for (i = 0; i < CHARLIE_PINS; ++i)
+		buf->slots[i].ddr = buf->slots[i].port = 0;
+	buf->period = 0;
+
+	for (y = 0; y < LAYERS_NUM; ++y) {
+		const uint8_t* pins = s_charlie_leds[y];
+		uint16_t l = frame[y];
+
+		for (i = 0; l && i < LEDS_NUM; ++i, l >>= 1) {
+			uint8_t pin, anode;
+
+			if (!(l & 1))
+				continue;
+			pin = pgm_read_byte(&pins[i]);
+			anode = pgm_read_byte(&s_anodes[pin >> 4]);
+			// anode high, cathode low
+			buf->slots[pin >> 4].port = anode;
+			buf->slots[pin >> 4].ddr |= anode | (1 << (pin & 0x0f));
+			buf->period = leds_slot_period(CHARLIE_PINS);
+		}
+	}
+
+	s_flip = 1;
+}
+
+void leds_refresh()
+{
+	const leds_buf_t* buf = &s_bufs[s_front];
+	const charlie_slot_t* slot;
+
+	if (++s_slot == CHARLIE_PINS)
+		s_slot = 0;
+	// new frame from its first anode
+	if (s_flip) {
+		s_front ^= 1;
+		s_flip = 0;
+		buf = &s_bufs[s_front];
+		s_slot = 0;
+	}
+	slot = &buf->slots[s_slot];
+
+	// tri-state all, then drive the next anode and its cathodes
+	CHARLIE_DDR &= ~CHARLIE_MASK;
+	CHARLIE_PORT = (CHARLIE_PORT & ~CHARLIE_MASK) | slot->port;
+	CHARLIE_DDR |= slot->ddr;
+}
+
+#else
+
+typedef struct leds_buf {
+	uint16_t frame[LAYERS_NUM];
+	// layers with leds on, lit in turn
+	uint8_t  layers[LAYERS_NUM];
+	uint8_t  layers_num;
+	uint16_t period;
+} leds_buf_t;
+
+static const uint16_t s_led_slots[LED_SLOTS] PROGMEM = LED_SLOT_MASKS;
+
+static leds_buf_t s_bufs[2];
+static uint8_t s_layer;
+// refresh slot, i.e. group of columns lit now
+static uint8_t s_slot;
+
+void leds_init()
+{
+	ledmap_init();
+	ledmap_off();
+}
+
+void leds_show(const uint16_t* frame)
+{
+	leds_buf_t* buf;
+	uint8_t y;
+
+	// refresh keeps the front, the back is ours till the flip
+	s_flip = 0;
+	buf = &s_bufs[s_front ^ 1];
+
+	// save leds state, dark layers take no refresh time
+	buf->layers_num = 0;
+	for (y = 0; y < LAYERS_NUM; ++y) {
+		buf->frame[y] = frame[y];
+		if (frame[y])
+			buf->layers[buf->layers_num++] = y;
+	}
+	buf->period = buf->layers_num ?
+		leds_slot_period(LED_SLOTS * buf->layers_num) : 0;
+
+	s_flip = 1;
+}
+
+void leds_refresh()
+{
+	const leds_buf_t* buf = &s_bufs[s_front];
+	uint16_t leds;
+	uint8_t y;
+
+	// firstly turn off leds
+	ledmap_off();
+
+	// next group of columns, then next layer
+	if (++s_slot == LED_SLOTS) {
+		s_slot = 0;
+		if (++s_layer >= buf->layers_num)
+			s_layer = 0;
+	}
+	// new frame from its first layer
+	if (s_flip) {
+		s_front ^= 1;
+		s_flip = 0;
+		buf = &s_bufs[s_front];
+		s_slot = s_layer = 0;
+	}
+
+	// nothing to do
+	if (!buf->layers_num)
+		return;
+
+	y = buf->layers[s_layer];
+	leds = buf->frame[y] & pgm_read_word(&s_led_slots[s_slot]);
+
+	// turn on leds, then ground
+	ledmap_columns(leds);
+	ledmap_layer(y);
+}
+
+#endif
+
+uint16_t leds_period()
+{
+	return s_bufs[s_front].period;
+}
@@ -0,0 +1,38 @@
+#ifndef LEDS_H
+#define LEDS_H
+
+#include <avr/io.h>
+
+/*
+ * Led matrix refresh.
+ *
+ * One layer is shown at a time, its columns are lit by groups of
+ * LEDS_GROUP in turn on every refresh, then the next layer with leds
+ * on, i.e. persistence of vision, so at most LEDS_GROUP leds draw
+ * current at once. Charlieplexed leds are lit anode pin by anode
+ * pin instead. Geometry and pins are in ledmap.h, generated by
+ * tools/ledmap.py.
+ *
+ * Frames are double buffered: leds_show() renders into the back
+ * buffer with interrupts enabled, the next refresh flips a byte to
+ * take it and starts it from its first slot, so a frame is never
+ * torn and rendering costs the ISR nothing. With TICKLESS=1 the
+ * main loop wakes that refresh at the next sample period.
+ */
+
+void leds_init();
+
+// desk callback, see hw_fire_leds_t, main loop only
+void leds_show(const uint16_t* frame);
+
+// sample ISR
+void leds_refresh();
+
+// refresh rate which keeps leds flicker free
+#define LEDS_FRAME_RATE 100
+
+// CPU cycles between refreshes at LEDS_FRAME_RATE, 0 if leds are
+// off, for refreshing slower than the sample rate
+uint16_t leds_period();
+
+#endif //LEDS_H
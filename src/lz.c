@@ -0,0 +1,48 @@
+#include <avr/pgmspace.h>
+
+#include "lz.h"
+
+static void lz_token(lz_t* z)
+{
+	const uint8_t* t = z->src;
+	uint8_t b = pgm_read_byte(t);
+
+	if (b & LZ_MATCH) {
+		z->left = (b & ~LZ_MATCH) + LZ_MIN_MATCH;
+		z->copy = t - pgm_read_word(t + 1);
+		z->src  = t + 3;
+	} else {
+		z->left = b + 1;
+		z->copy = t + 1;
+		z->src  = t + 1 + z->left;
+	}
+}
+
+void lz_seek(lz_t* z, const uint8_t* data, const uint16_t* blocks,
+			 uint16_t pos)
+{
+	uint8_t skip = pos % LZ_BLOCK;
+
+	z->src = data + pgm_read_word(&blocks[pos / LZ_BLOCK]);
+	z->left = 0;
+
+	// whole tokens are skipped by their headers
+	while (skip) {
+		lz_token(z);
+		if (z->left > skip) {
+			z->copy += skip;
+			z->left -= skip;
+			break;
+		}
+		skip -= z->left;
+		z->left = 0;
+	}
+}
+
+uint8_t lz_read(lz_t* z)
+{
+	if (!z->left)
+		lz_token(z);
+	--z->left;
+	return pgm_read_byte(z->copy++);
+}
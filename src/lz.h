@@ -0,0 +1,36 @@
+#ifndef LZ_H
+#define LZ_H
+
+#include <avr/io.h>
+
+/*
+ * Lossless LZ block codec of flash assets, packed by tools/lzpack.py,
+ * SAMPLES_LZ=1 packs the sample pool.
+ *
+ * Matches copy from literal runs of the packed stream, not from
+ * unpacked bytes, so the decoder has no RAM window: 5 bytes of state,
+ * one LPM per byte and a token per run, far ahead of 8000 bytes/s.
+ *
+ * Every LZ_BLOCK unpacked bytes start a token, the seek table holds
+ * packed offsets of blocks. lz_seek() goes to a block, then skips
+ * tokens by their headers, bounded by a block, ~1000 cycles at most.
+ */
+
+#define LZ_BLOCK     128
+#define LZ_MIN_MATCH 3
+// token: literal run of (t + 1) bytes, or a match of
+// (t & ~LZ_MATCH) + LZ_MIN_MATCH bytes at a 16-bit distance before it
+#define LZ_MATCH     0x80
+
+typedef struct lz {
+	const uint8_t* src;  // next token, PROGMEM
+	const uint8_t* copy; // next byte of the token, PROGMEM
+	uint8_t        left; // bytes left of the token
+} lz_t;
+
+// safe to call from ISR
+void lz_seek(lz_t* z, const uint8_t* data, const uint16_t* blocks,
+			 uint16_t pos);
+uint8_t lz_read(lz_t* z);
+
+#endif //LZ_H
@@ -2,9 +2,28 @@
 #include <avr/interrupt.h>
 #include <avr/pgmspace.h>
 #include <avr/fuse.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
 
+#if ASSET_BUNDLE
+#include "sound.h"
+#include "assets.h"
+#else
 #include "sounddata.h"
+#endif
 #include "fedordesk.h"
+#include "stream.h"
+#include "uart.h"
+#include "upload.h"
+#include "nvm.h"
+#include "telemetry.h"
+#include "stack.h"
+#include "leds.h"
+#include "sample.h"
+#include "sched.h"
+#include "spectrum.h"
+#include "lz.h"
+#include "bundle.h"
 
 /*
  * ATMega16
@@ -28,6 +47,11 @@
  * LED[0..11]   -> PA[0..7], PC[0..3]
  * GR[0..2]     -> PC[4..6]
  * PD7          -> out speaker PWM
+ * PD6          -> sample ISR probe, ISR_PROBE=1, or spectrum one, 2
+ *
+ * Led pins and geometry are generated into ledmap.h by
+ * tools/ledmap.py, the above is the default 12x3 desk. Charlieplexed
+ * it takes 7 pins, e.g. PA[0..6], see leds.c.
  *
  */
 
@@ -48,11 +72,201 @@ FUSES =
 #define SAMPLE_RATE 8000 // playback rate, hz
 #define CB_RATE     10   // callback rate, hz
 
-// leds state
-static uint8_t s_leds_layer;
-static uint16_t	s_leds_state;
-static uint16_t s_leds_mask;
+// pins jitter? ignore sequential presses in 500ms
+#define DEBOUNCE_MS 500
+
+// leds refresh rate, hz, TIMER0 drives it when the sample ISR is
+// naked, otherwise it is the sample ISR
+#if SAMPLE_ASM
+#define TICK_RATE   4000
+#else
+#define TICK_RATE   SAMPLE_RATE
+#endif
+
+#if SAMPLE_ASM && NOISE_SHAPING
+#error "SAMPLE_ASM fast path has no noise shaping"
+#endif
+
+#if TICKLESS && SAMPLE_ASM
+#error "TICKLESS stretches the C sample ISR, TIMER0 ticks with SAMPLE_ASM"
+#endif
+
+#if SPECTRUM && SAMPLE_ASM
+#error "SPECTRUM takes samples of the C mixer, SAMPLE_ASM skips it"
+#endif
+
+#if SAMPLES_LZ && SAMPLE_ASM
+#error "SAMPLES_LZ packs the pool, SAMPLE_ASM reads it raw"
+#endif
+
+#if BEAT_MAP && SAMPLE_ASM
+#error "BEAT_MAP compares the theme position of the C mixer, SAMPLE_ASM skips it"
+#endif
+
+// longest TIMER1 period while silent, cycles
+#define TICKLESS_MAX 56000
+// cycles of a TIMER1 period cut short by the main loop to set it
+#define TICKLESS_SLACK 256
+
+#if ISR_PROBE && (LEDMAP_PINS_D & (1 << 6))
+#error "ISR probe pin PD6 is taken by leds"
+#endif
+
+// playback state
+enum {
+	playback_off = 0, // PWM is gated
+	playback_rise,    // PWM level goes up from 0 to the 0x80 midpoint
+	playback_on,      // voices are mixed, gain ramps to s_gain_target
+	playback_fall     // PWM level goes down from the midpoint to 0
+};
 static uint8_t s_playback;
+// PWM level while rising or falling
+static uint8_t s_level;
+// master gain, Q1.7 like voice volume, one step per sample
+static uint8_t s_gain;
+static uint8_t s_gain_target;
+
+#if TELEMETRY
+// sample ISR took longer than a sample period
+static uint16_t s_isr_overruns;
+#endif
+
+// main loop tasks, see sched.h
+enum {
+	task_anim = 0,
+	task_debounce,
+#if SAVE_STATE
+	task_save,
+#endif
+#if TELEMETRY
+	task_telemetry,
+#endif
+#if SPECTRUM
+	task_spectrum,
+#endif
+#if BEAT_MAP
+	task_beat,
+#endif
+	TASKS_NUM
+};
+static task_t s_tasks[TASKS_NUM];
+
+#if NOISE_SHAPING
+// fractional bits lost by the previous sample, Q0.7
+static uint8_t s_shaping_err;
+#endif
+
+// no clip, never a clip or track id, erased EEPROM state reads so
+#define CLIP_NONE 0xff
+
+// where to resume the stopped theme clip, CLIP_NONE if nowhere
+static struct {
+	uint8_t  id;
+	uint16_t pos;
+} s_resume = { .id = CLIP_NONE };
+
+#if ASSET_BUNDLE
+// sound bank of the bundle, see bundle_sound(), the same names as
+// of sounddata.h, no clips if the bundle is broken
+#if SAMPLES_LZ
+static const uint8_t*  s_lz;
+static const uint16_t* s_lz_blocks;
+#else
+static const uint8_t*  s_samples;
+#endif
+static const clip_t*   s_clips;
+static const uint16_t* s_cues;
+#if BEAT_MAP
+static const beat_t*   s_beats;
+#endif
+#endif
+
+// mixer voices: looping background theme and one-shot effect
+enum {
+	voice_theme  = 0,
+	voice_effect = 1,
+	VOICES_NUM
+};
+
+// voice volume, Q1.7 fixed point, i.e. 128 is 1.0
+#define VOLUME_MAX    128
+#define VOLUME_THEME  96
+#define VOLUME_EFFECT 128
+
+// runtime voice flags next to clip flags, samples come from
+// the serial flash stream, from the host over UART or from
+// the uploaded clip in EEPROM
+#define VOICE_STREAM (1 << 7)
+#define VOICE_UART   (1 << 6)
+#define VOICE_EEPROM (1 << 5)
+// clip ids past the internal ones are serial flash tracks,
+// pcm streamed by the host and the uploaded press clip
+#define TRACK_CLIP(n) (CLIPS_NUM + (n))
+#define UART_CLIP     TRACK_CLIP(STREAM_TRACKS_MAX)
+#define EEPROM_CLIP   (UART_CLIP + 1)
+#if EEPROM_CLIP >= CLIP_NONE
+#error "clip and track ids run into CLIP_NONE"
+#endif
+
+typedef struct voice {
+	uint8_t  id;
+	uint8_t  flags;
+	uint8_t  active;
+	uint8_t  volume;
+	uint16_t pos;
+	uint16_t start;
+	uint16_t end;
+#if SAMPLES_LZ
+	// decoder of the packed pool at pos
+	lz_t     lz;
+#endif
+} voice_t;
+
+static voice_t s_voices[VOICES_NUM] = {
+	[voice_theme]  = { .volume = VOLUME_THEME },
+	[voice_effect] = { .volume = VOLUME_EFFECT }
+};
+
+// clip for each button mode
+static const uint8_t s_button_clips[BUTTONS_NUM] = {
+	CLIP_THEME,  // button0
+	CLIP_PHRASE, // button1
+	CLIP_INTRO   // button2
+};
+
+#if SPI_FLASH
+// serial flash tracks, take over button clips
+static uint8_t s_tracks_num;
+#endif
+
+#if BEAT_MAP
+/*
+ * Beats of the theme clip, see sound.h. They are found when the clip
+ * starts, then the sample ISR only compares the theme position with
+ * the next beat, a beat reached wakes the main loop to show it.
+ */
+#define BEAT_NONE 0xffff
+
+// next beat and its pool offset, BEAT_NONE if the theme has no beats
+static uint16_t s_beat;
+static uint16_t s_beat_pos = BEAT_NONE;
+// beats of the theme clip
+static uint16_t s_beat_first;
+static uint16_t s_beat_end;
+// last beat reached, BEAT_NONE when playback is over
+static volatile uint16_t s_beat_hit = BEAT_NONE;
+#endif
+
+#if SAVE_STATE
+// state is saved 2s after the last press, so a burst of presses
+// costs one write, and every 30s while playing for the position
+#define SAVE_DELAY  (2 * CB_RATE)
+#define SAVE_PERIOD (30 * CB_RATE)
+
+static uint8_t s_save_ticks;
+static uint16_t s_save_period;
+static uint8_t s_save;
+#endif
 
 // sampler and leds 16-bit timer
 static void timer1_init()
@@ -72,6 +286,93 @@ static void timer1_init()
 	TIMSK |= (1 << OCIE1A);
 }
 
+#if TICKLESS
+/*
+ * Silent, TIMER1 fires only for the next leds refresh slot or the
+ * next scheduler timer, ~150 times a second with leds off instead
+ * of 8000. Every ISR counts its period, so ticks are not lost and
+ * timers expire on the same cycle as at the sample rate.
+ */
+
+// TIMER1 period and cycles not yet counted as scheduler ticks,
+// below 1ms after every ISR, so both fit 16 bits
+static uint16_t s_period = F_CPU / SAMPLE_RATE;
+static uint16_t s_cycles;
+
+// sample ISR, playback is off
+static void tickless_next()
+{
+	uint16_t period = TICKLESS_MAX;
+	uint16_t leds = leds_period();
+	uint16_t ms = sched_next();
+
+	if (leds && leds < period)
+		period = leds;
+	if (ms < TICKLESS_MAX / (F_CPU / SCHED_RATE)) {
+		uint16_t deadline = ms ? ms * (F_CPU / SCHED_RATE) - s_cycles : 0;
+
+		if (deadline < period)
+			period = deadline;
+	}
+	if (period < F_CPU / SAMPLE_RATE)
+		period = F_CPU / SAMPLE_RATE;
+
+	// CTC, TCNT1 is way below, OCR1A isn't buffered (p.98)
+	s_period = period;
+	OCR1A = period - 1;
+}
+
+// playback starts, back to the sample rate, interrupts disabled
+static void tickless_stop()
+{
+	// the long period is cut short, its time is not lost
+	if (TIFR & (1 << OCF1A)) {
+		TIFR = (1 << OCF1A);
+		s_cycles += s_period;
+	}
+	s_cycles += TCNT1;
+	TCNT1 = 0;
+	s_period = F_CPU / SAMPLE_RATE;
+	OCR1A = s_period - 1;
+}
+
+/*
+ * leds_show() left a frame for the refresh, wake it at the next
+ * sample period as the sample rate would, main loop. Scheduler ticks
+ * are sample periods apart, so the grid is counted from the last
+ * one, with room for the division and the writes.
+ */
+static void tickless_flip()
+{
+	uint16_t now, next;
+
+	cli();
+	// at the sample rate or the ISR is due, its refresh takes it
+	if (s_playback == playback_off && !(TIFR & (1 << OCF1A))) {
+		now = s_cycles + TCNT1;
+		next = (now / (F_CPU / SAMPLE_RATE) + 1) * (F_CPU / SAMPLE_RATE);
+		if (next - now < TICKLESS_SLACK)
+			next += F_CPU / SAMPLE_RATE;
+		if (next - s_cycles < s_period) {
+			s_period = next - s_cycles;
+			OCR1A = s_period - 1;
+		}
+	}
+	sei();
+}
+#endif
+
+#if SAMPLE_ASM
+// leds and callback 8-bit timer, CTC mode (p.80)
+static void timer0_init()
+{
+	// CTC, prescaler 8 (p.83)
+	TCCR0 = (1 << WGM01) | (1 << CS01);
+	OCR0 = F_CPU / 8 / TICK_RATE - 1;
+	TIMSK |= (1 << OCIE0);
+}
+#endif
+
 // set up Timer 2 to do pulse width modulation on the speaker pin
 static void timer2_init()
 {
@@ -98,21 +399,297 @@ static void timer2_deinit()
 	PORTD &= ~(1 << DDD7);
 }
 
-static void start_playback()
+#if SAMPLE_ASM
+// take the theme position back from the naked ISR, before the
+// voices are touched, see sample.h
+static void fast_sync()
+{
+	voice_t* v = &s_voices[voice_theme];
+
+	if (!s_fast_cursor)
+		return;
+	s_fast_scale = 0;
+	v->pos = s_fast_cursor - s_samples;
+	s_fast_cursor = 0;
+
+	// naked ISR played the last byte
+	if (v->pos == v->end) {
+		if (v->flags & CLIP_LOOP)
+			v->pos = v->start;
+		else
+			v->active = 0;
+	}
+}
+
+// theme from flash alone at a steady gain goes to the naked ISR
+static void fast_arm()
 {
-	if (s_playback)
+	voice_t* v = &s_voices[voice_theme];
+	uint8_t scale;
+
+	if (s_playback != playback_on || !v->active ||
+		(v->flags & (VOICE_STREAM | VOICE_UART | VOICE_EEPROM)) ||
+		s_voices[voice_effect].active ||
+		s_gain != s_gain_target)
 		return;
-	s_playback = 1;
-	timer2_init();
+	scale = (v->volume * s_gain) >> 7;
+	if (!scale)
+		return;
+
+	s_fast_cursor = &s_samples[v->pos];
+	s_fast_end    = &s_samples[v->end];
+	s_fast_offset = 0x80 - scale;
+	s_fast_scale  = scale;
 }
+#else
+static inline void fast_sync()
+{
+}
+#endif
+
+// pos of a pool clip moved, bounded by a block, safe to call from ISR
+static inline void voice_seek(voice_t* v)
+{
+#if SAMPLES_LZ
+	lz_seek(&v->lz, s_lz, s_lz_blocks, v->pos);
+#endif
+}
+
+// constant time, safe to call from ISR
+static void load_clip(voice_t* v, uint8_t id)
+{
+	const clip_t* clip;
+	uint16_t length;
+
+#if SPI_FLASH
+	if (v->flags & VOICE_STREAM)
+		stream_close();
+#endif
+	if (id == EEPROM_CLIP) {
+		v->id     = id;
+		v->flags  = VOICE_EEPROM;
+		v->start  = nvm_clip(&length);
+		v->end    = v->start + length;
+		v->pos    = v->start;
+		v->active = 1;
+		return;
+	}
+#if UART_STREAM
+	if (id == UART_CLIP) {
+		v->id     = id;
+		v->flags  = VOICE_UART;
+		v->active = 1;
+		return;
+	}
+#endif
+#if SPI_FLASH
+	if (id >= CLIPS_NUM) {
+		v->id     = id;
+		v->flags  = VOICE_STREAM;
+		v->active = 1;
+		stream_open(id - TRACK_CLIP(0));
+		return;
+	}
+#endif
+
+#if ASSET_BUNDLE
+	// broken bundle, nothing to play
+	if (!s_clips) {
+		v->active = 0;
+		return;
+	}
+#endif
+
+	clip = &s_clips[id];
+	v->id     = id;
+	v->flags  = pgm_read_byte(&clip->flags);
+	v->start  = pgm_read_word(&clip->offset);
+	v->end    = v->start + pgm_read_word(&clip->length);
+	v->pos    = v->start;
+	v->active = 1;
+	voice_seek(v);
+}
+
+// last cue point of the clip at or before the voice position
+static uint16_t voice_cue(const voice_t* v)
+{
+	const clip_t* clip = &s_clips[v->id];
+	const uint16_t* cue = &s_cues[pgm_read_byte(&clip->cue)];
+	uint8_t n = pgm_read_byte(&clip->cues_num);
+	uint16_t pos = v->start;
+
+	while (n--) {
+		uint16_t c = pgm_read_word(cue++);
+		if (c > v->pos)
+			break;
+		pos = c;
+	}
+	return pos;
+}
+
+#if BEAT_MAP
+// theme clip loaded or moved, bounded by beats of the clip
+static void beat_seek(const voice_t* v)
+{
+	const clip_t* clip;
+
+	s_beat_pos = BEAT_NONE;
+	if (v->id >= CLIPS_NUM || !v->active)
+		return;
 
+	clip = &s_clips[v->id];
+	s_beat_first = pgm_read_word(&clip->beat);
+	s_beat_end = s_beat_first + pgm_read_byte(&clip->beats_num);
+	for (s_beat = s_beat_first; s_beat != s_beat_end; ++s_beat)
+		if (pgm_read_word(&s_beats[s_beat].pos) >= v->pos)
+			break;
+	// past the last one, the first comes when the loop wraps
+	if (s_beat == s_beat_end)
+		s_beat = s_beat_first;
+	if (s_beat != s_beat_end)
+		s_beat_pos = pgm_read_word(&s_beats[s_beat].pos);
+}
+
+// sample ISR, the theme plays the next beat now
+static void beat_next()
+{
+	s_beat_hit = s_beat;
+	if (++s_beat == s_beat_end)
+		s_beat = s_beat_first;
+	s_beat_pos = pgm_read_word(&s_beats[s_beat].pos);
+	sched_wake(task_beat);
+}
+
+// playback is over, leds of the last beat go dark
+static void beat_stop()
+{
+	s_beat_pos = BEAT_NONE;
+	s_beat_hit = BEAT_NONE;
+	sched_wake(task_beat);
+}
+#endif
+
+static void start_clip(uint8_t id)
+{
+	voice_t* theme = &s_voices[voice_theme];
+
+	fast_sync();
+
+	// same clip, keep playing
+	if (!theme->active || theme->id != id) {
+		load_clip(theme, id);
+		// continue stopped clip from the interrupted note, once
+		if (s_resume.id == id) {
+			theme->pos = s_resume.pos;
+			voice_seek(theme);
+			s_resume.id = CLIP_NONE;
+		}
+#if BEAT_MAP
+		beat_seek(theme);
+#endif
+	}
+
+	s_gain_target = VOLUME_MAX;
+	switch (s_playback) {
+	case playback_off:
+#if TICKLESS
+		tickless_stop();
+#endif
+		timer2_init();
+		s_level = 0;
+		s_playback = playback_rise;
+		break;
+	case playback_fall:
+		s_playback = playback_rise;
+		break;
+	}
+}
+
+static uint8_t button_clip(button_t b)
+{
+#if SPI_FLASH
+	if (b - button0 < s_tracks_num)
+		return TRACK_CLIP(b - button0);
+#endif
+	return s_button_clips[b - button0];
+}
+
+static void start_playback(button_t b)
+{
+	voice_t* theme = &s_voices[voice_theme];
+	uint8_t id = button_clip(b);
+	uint16_t length;
+
+	fast_sync();
+
+	// host stream is not interrupted by buttons
+	if (theme->active && (theme->flags & VOICE_UART))
+		id = UART_CLIP;
+
+	// press sound on top of whatever is playing
+	load_clip(&s_voices[voice_effect],
+			  nvm_clip(&length) ? EEPROM_CLIP : CLIP_COIN);
+
+	start_clip(id);
+}
+
+// fade out, PWM is gated from the ISR when level reaches 0
 static void stop_playback()
 {
-	if (!s_playback)
+	voice_t* theme = &s_voices[voice_theme];
+
+	fast_sync();
+
+	// host stream ends when host stops sending
+	if (theme->active && (theme->flags & VOICE_UART))
+		return;
+
+	switch (s_playback) {
+	case playback_rise:
+		s_playback = playback_fall;
+		break;
+	case playback_on:
+		s_gain_target = 0;
+		if (theme->active && !(theme->flags & VOICE_STREAM)) {
+			s_resume.id  = theme->id;
+			s_resume.pos = voice_cue(theme);
+		}
+		break;
+	}
+}
+
+#if ASSET_BUNDLE
+// before interrupts are enabled, stays silent if the bundle is broken
+// or doesn't fit the firmware, e.g. updated with other clips
+static void bundle_sound()
+{
+	asset_t pcm, clips, cues, beats;
+
+	if (!bundle_init() ||
+		!bundle_asset(ASSET_SAMPLES, asset_pcm, &pcm) ||
+		!bundle_asset(ASSET_CLIPS, asset_table, &clips) ||
+		!bundle_asset(ASSET_CUES, asset_table, &cues) ||
+		!bundle_asset(ASSET_BEATS, asset_table, &beats) ||
+		pcm.rate != SAMPLE_RATE ||
+		pcm.codec != (SAMPLES_LZ ? codec_lz : codec_raw) ||
+		clips.size != CLIPS_NUM * sizeof(clip_t))
 		return;
-	s_playback = 0;
-	timer2_deinit();
+
+#if SAMPLES_LZ
+	// seek table, then the stream
+	s_lz_blocks = (const uint16_t*)bundle_data(&pcm);
+	s_lz = bundle_data(&pcm) +
+		(pcm.length + LZ_BLOCK - 1) / LZ_BLOCK * sizeof(uint16_t);
+#else
+	s_samples = bundle_data(&pcm);
+#endif
+	s_cues = (const uint16_t*)bundle_data(&cues);
+#if BEAT_MAP
+	s_beats = (const beat_t*)bundle_data(&beats);
+#endif
+	s_clips = (const clip_t*)bundle_data(&clips);
 }
+#endif
 
 static void external_int_init()
 {
@@ -128,145 +705,589 @@ static void external_int_init()
 static void init_io_ports()
 {
 	/*
-	 * LED[0..11]   -> PA[0..7], PC[0..3]
-	 * GR[0..2]     -> PC[4..6]
 	 * PD7 -> out speaker PWM
+	 * PD6 -> sample ISR probe
 	 */
 
-	// 0..7 A pins as output
-	DDRA |= 0b11111111;
-	// 0..3 C pins as output
-	DDRC |= 0b00001111;
-	// 4..6 C pins as output
-	DDRC |= 0b01110000;
 	// PWM speaker pin as out
 	DDRD = (1 << DDD7);
+#if ISR_PROBE
+	DDRD |= (1 << DDD6);
+#endif
 
-	// 0..7 A pins to low
-	PORTA &= ~0b11111111;
-	// 0..3 C pins to low
-	PORTC &= ~0b00001111;
-	// 4..6 C pins to low
-	PORTC &= ~0b01110000;
+	// led columns and grounds
+	leds_init();
 }
 
-static void hw_fire_leds(const uint16_t* leds, uint8_t y)
+// next sample of the voice scaled by its volume and master gain, Q8.7
+static inline int16_t mix_voice(voice_t* v, uint8_t gain)
 {
-	// save leds state
-	s_leds_layer = y;
-	s_leds_state = *leds;
-	// 6 max fired leds at a time
-	// 20mA * 6 = 120mA max
-	s_leds_mask = 0b111111;
+	uint8_t b;
+
+	if (!v->active)
+		return 0;
+
+#if SPI_FLASH
+	if (v->flags & VOICE_STREAM) {
+		switch (stream_read(&b)) {
+		case stream_underrun:
+			// conceal with silence
+			b = 0x80;
+			break;
+		case stream_eof:
+			v->active = 0;
+			return 0;
+		}
+	}
+	else
+#endif
+#if UART_STREAM
+	if (v->flags & VOICE_UART) {
+		// underruns are concealed by the uart stream itself
+		if (uart_stream_read(&b) == stream_eof) {
+			v->active = 0;
+			return 0;
+		}
+	}
+	else
+#endif
+	{
+		if (v->flags & VOICE_EEPROM)
+			// EEPROM is being written, conceal with silence
+			b = nvm_ready() ? nvm_read_isr(v->pos) : 0x80;
+		else
+#if SAMPLES_LZ
+			b = lz_read(&v->lz);
+#else
+			b = pgm_read_byte(&s_samples[v->pos]);
+#endif
+
+		// end of clip
+		if (++v->pos == v->end) {
+			if (v->flags & CLIP_LOOP) {
+				v->pos = v->start;
+				voice_seek(v);
+			}
+			else
+				v->active = 0;
+		}
+	}
+
+	// unsigned pcm to signed
+	int8_t s = b - 0x80;
+
+	// int8 * uint8, single MULSU
+	return s * (uint8_t)((v->volume * gain) >> 7);
 }
 
-static void fire_leds()
+/*
+ * Two voice mixer, worst case (both voices active, one of them
+ * wraps) per mixed sample, an unverified estimate by instruction
+ * count, not measured on a target:
+ *
+ *   mix_voice()       ~30 cycles x 2  (LPM 3, MUL + MULSU 4, wrap ~10)
+ *   sum and clamp     ~12 cycles
+ *   noise shaping      ~6 cycles      (NOISE_SHAPING=1: add, and, store)
+ *   gain ramp          ~6 cycles
+ *   shift and store    ~5 cycles
+ *
+ * ISR prologue/epilogue, which saves r0/r1 for MUL, comes on top.
+ * The budget is F_CPU / SAMPLE_RATE = 1000 cycles, ISR_PROBE=1 and
+ * fedorsim -i measure the whole ISR against it.
+ *
+ * Start and stop never step the PWM output: level ramps 0 -> 0x80
+ * before the voices are mixed with gain ramping 0 -> 1.0, and back
+ * on stop, 16ms each way.
+ */
+static void load_audio_sample()
 {
-	// firstly turn off leds
-
-	// 0..7 A pins to low
-	PORTA &= ~0b11111111;
-	// 0..3 C pins to low
-	PORTC &= ~0b00001111;
-	// 4..6 C pins to low
-	PORTC &= ~0b01110000;
+	fast_sync();
 
-	// nothing to do
-	if (!s_leds_state)
+	switch (s_playback) {
+	case playback_off:
 		return;
+	case playback_rise:
+		OCR2 = ++s_level;
+		if (s_level == 0x80)
+			s_playback = playback_on;
+		return;
+	case playback_fall:
+		OCR2 = --s_level;
+		if (s_level == 0) {
+			s_playback = playback_off;
+			timer2_deinit();
+#if BEAT_MAP
+			beat_stop();
+#endif
+		}
+		return;
+	}
+
+#if BEAT_MAP
+	// one compare a sample, before the theme takes the beat sample
+	if (s_voices[voice_theme].pos == s_beat_pos)
+		beat_next();
+#endif
 
-	// toggle mask
-	s_leds_mask ^= 0b111111111111;
+	// volumes are <= VOLUME_MAX, so the sum can't overflow int16
+	int16_t mix = mix_voice(&s_voices[voice_theme], s_gain) +
+		mix_voice(&s_voices[voice_effect], s_gain);
 
-	// current fired leds
-	uint16_t leds = s_leds_state & s_leds_mask;
+	// saturate, still Q8.7
+	if (mix > 127 * 128)
+		mix = 127 * 128;
+	else if (mix < -128 * 128)
+		mix = -128 * 128;
 
-	// turn on led
-	PORTA |= (leds & 0xff);
-	PORTC |= ((leds >> 8) & 0b1111);
+#if NOISE_SHAPING
+	// first-order error feedback: quantization error of the previous
+	// sample is added to this one, so the noise spectrum is shaped by
+	// (1 - z^-1) and pushed up to 4kHz, away from the speaker band
+	mix += s_shaping_err;
+	s_shaping_err = mix & 0x7f;
+#endif
 
-	// turn on ground
-	PORTC |= (1 << ((s_leds_layer % LAYERS_NUM) + 4));
+	// back to 8 bits
+	mix >>= 7;
+
+#if SPECTRUM
+	// bands are computed by the main loop
+	spectrum_put(mix);
+#endif
+
+	// volume ramp
+	if (s_gain < s_gain_target)
+		++s_gain;
+	else if (s_gain > s_gain_target)
+		--s_gain;
+	else if (s_gain == 0) {
+		// faded out, centred at 0x80, go down to gate PWM
+#if SPI_FLASH
+		if (s_voices[voice_theme].flags & VOICE_STREAM)
+			stream_close();
+#endif
+		s_voices[voice_theme].active = 0;
+		s_voices[voice_effect].active = 0;
+		s_level = 0x80;
+		s_playback = playback_fall;
+	}
+
+	// write audio sample byte to PWM compare register
+	OCR2 = (uint8_t)mix + 0x80;
+
+	// one-shot clips are over
+	if (!s_voices[voice_theme].active && !s_voices[voice_effect].active)
+		s_gain_target = 0;
+
+#if SAMPLE_ASM
+	// next samples are naked
+	fast_arm();
+#endif
 }
 
-static void load_audio_sample()
+#if TELEMETRY
+// every second, interrupts disabled
+static void report_counters(uint16_t stack_free)
 {
-	static uint16_t s_sample = 0;
+	uint16_t underruns = 0;
 
-	// read audio sample byte to PWM compare register
-	OCR2 = pgm_read_byte(&s_samples[s_sample++ % sizeof(s_samples)]);
+#if SPI_FLASH
+	underruns += stream_underruns();
+#endif
+#if UART_STREAM
+	underruns += uart_rx_underruns();
+	tm_log(tm_rx_overruns, uart_rx_overruns());
+#endif
+	tm_log(tm_isr_overruns, s_isr_overruns);
+	tm_log(tm_underruns, underruns);
+	tm_log(tm_stack_free, stack_free);
+}
+#endif
 
-	// avoid overflow
-	s_sample = s_sample % sizeof(s_samples);
+#if SAVE_STATE
+// 100ms, interrupts disabled
+static void save_tick()
+{
+	if (s_save_ticks && !--s_save_ticks)
+		s_save = 1;
+	if (s_playback == playback_on && ++s_save_period == SAVE_PERIOD) {
+		s_save_period = 0;
+		s_save = 1;
+	}
 }
 
-// TIMER1 Output Compare Match Interrupt service routine
-// works on SAMPLE_RATE
-ISR(TIMER1_COMPA_vect)
+// main loop, 0 if EEPROM is busy
+static uint8_t save_state()
 {
-	// global variable to count the number of overflows
-	static uint16_t s_overflow = 0;
+	voice_t* theme = &s_voices[voice_theme];
+	nvm_state_t st;
 
-	// play audio
-	load_audio_sample();
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		button_t b;
+		led_speed_t speed;
+
+		fast_sync();
+		desk_get_mode(&b, &speed);
+		st.button  = b;
+		st.speed   = speed;
+		st.playing = theme->active && !(theme->flags & VOICE_UART);
+		st.clip    = s_resume.id;
+		st.pos     = s_resume.pos;
+		if (st.playing) {
+			st.clip = theme->id;
+			// tracks start over
+			st.pos  = (theme->flags & VOICE_STREAM) ? 0 : voice_cue(theme);
+		}
+	}
+
+	return nvm_state_save(&st);
+}
+
+// before interrupts are enabled, bounded by the log size
+static void restore_state()
+{
+	nvm_state_t st;
+
+	if (!nvm_state_load(&st) || st.button > button2 || st.speed >= LED_SPEEDS)
+		return;
+
+	desk_set_mode(st.button, st.speed);
+
+	// position must be within the clip, the sound bank may have changed
+#if ASSET_BUNDLE
+	if (st.clip < CLIPS_NUM && s_clips) {
+#else
+	if (st.clip < CLIPS_NUM) {
+#endif
+		const clip_t* clip = &s_clips[st.clip];
+		uint16_t start = pgm_read_word(&clip->offset);
+
+		if (st.pos >= start && st.pos - start < pgm_read_word(&clip->length)) {
+			s_resume.id  = st.clip;
+			s_resume.pos = st.pos;
+		}
+	}
+
+	if (st.playing && st.button != button_unknown &&
+		st.clip == button_clip(st.button))
+		start_clip(st.clip);
+}
+#endif
+
+// leds and scheduler tick, works on TICK_RATE
+static inline void tick()
+{
+#if !TICKLESS
+	// global variable to count the number of overflows
+	static uint8_t s_overflow = 0;
+#endif
 
 	// fire leds on every interrupt for power savings
 	// i.e. do persistence of vision (pov) with frequent flicking
-	fire_leds();
+	leds_refresh();
 
-	// call desk callback
-	if (++s_overflow == SAMPLE_RATE / CB_RATE) {
-		desk_timer_100ms_callback();
+#if TICKLESS
+	// 1ms ticks of main loop tasks in the elapsed period
+	s_cycles += s_period;
+	while (s_cycles >= F_CPU / SCHED_RATE) {
+		s_cycles -= F_CPU / SCHED_RATE;
+		sched_tick();
+	}
+	if (s_playback == playback_off)
+		tickless_next();
+#else
+	// 1ms tick of main loop tasks
+	if (++s_overflow == TICK_RATE / SCHED_RATE) {
+		sched_tick();
 
 		// reset overflow counter
 		s_overflow = 0;
 	}
+#endif
 }
 
-ISR(INT0_vect)
+// TIMER1 Output Compare Match Interrupt service routine
+// works on SAMPLE_RATE, with SAMPLE_ASM it is the C path of the
+// naked one in sample.c
+#if SAMPLE_ASM
+ISR(SAMPLE_C_vect)
+#else
+ISR(TIMER1_COMPA_vect)
+#endif
+{
+#if ISR_PROBE == 1
+	// high for the ISR duration, sim -i measures it
+	PORTD |= (1 << 6);
+#endif
+
+	// play audio
+	load_audio_sample();
+
+#if !SAMPLE_ASM
+	tick();
+#endif
+
+#if TELEMETRY
+	// next compare match is already pending, i.e. we are late
+	if (TIFR & (1 << OCF1A))
+		++s_isr_overruns;
+#endif
+
+#if ISR_PROBE == 1
+	PORTD &= ~(1 << 6);
+#endif
+}
+
+#if SAMPLE_ASM
+ISR(TIMER0_COMP_vect)
 {
-	if (button_unknown == desk_button_pressed(button0))
+	tick();
+}
+#endif
+
+static void button_isr(button_t pressed)
+{
+#if TELEMETRY
+	tm_log(tm_button, pressed);
+#endif
+
+	button_t b;
+
+	// bounce or another button within DEBOUNCE_MS, playback goes on
+	if (!desk_button_pressed(pressed, &b))
+		return;
+	if (button_unknown == b)
 		stop_playback();
 	else
-		start_playback();
+		start_playback(b);
+
+	sched_wake(task_debounce);
+	// started animation shows its first frame now
+	sched_wake(task_anim);
+
+#if SAVE_STATE
+	s_save_ticks = SAVE_DELAY;
+#endif
 }
 
-ISR(INT1_vect)
+// sleeps till the next frame of any animation, woken by presses
+static void anim_task(pt_t* pt)
 {
-	if (button_unknown == desk_button_pressed(button1))
-		stop_playback();
+	static uint16_t s_last;
+	uint16_t now = sched_now(), next;
+
+	// desk is shared with button ISRs
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		next = desk_timer_callback(now - s_last);
+	}
+	s_last = now;
+	// rendered to the back buffer, shown by the next refresh
+	desk_fire_leds();
+#if TICKLESS
+	tickless_flip();
+#endif
+
+	if (next)
+		sched_after(task_anim, next);
 	else
-		start_playback();
+		sched_cancel(task_anim);
+}
+
+// woken by an accepted press, ignores others till DEBOUNCE_MS
+static void debounce_task(pt_t* pt)
+{
+	PT_BEGIN(pt);
+	sched_after(task_debounce, DEBOUNCE_MS);
+	PT_WAIT_WHILE(pt, sched_pending(task_debounce));
+	desk_debounce_end();
+	PT_END(pt);
+}
+
+#if SAVE_STATE
+static void save_task(pt_t* pt)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		save_tick();
+	}
+	// EEPROM is busy, try again next time
+	if (s_save && save_state())
+		s_save = 0;
+}
+#endif
+
+#if TELEMETRY
+static void telemetry_task(pt_t* pt)
+{
+	// scan is too long for interrupts disabled
+	uint16_t stack_free = stack_unused();
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		report_counters(stack_free);
+	}
+}
+#endif
+
+#if SPECTRUM
+static void spectrum_task(pt_t* pt)
+{
+	uint8_t levels[SPECTRUM_BANDS], fire = 0;
+
+	if (!spectrum_poll(levels))
+		return;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		fire = desk_spectrum(levels);
+	}
+	if (fire)
+		sched_wake(task_anim);
+}
+#endif
+
+#if BEAT_MAP
+static void beat_task(pt_t* pt)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		uint16_t hit = s_beat_hit;
+
+		if (hit == BEAT_NONE)
+			desk_beat(0, 0);
+		else
+			desk_beat(pgm_read_byte(&s_beats[hit].layer),
+					  pgm_read_word(&s_beats[hit].leds));
+	}
+	sched_wake(task_anim);
+}
+#endif
+
+// nothing to do till an interrupt, the sample or tick one at most
+// 1ms away, wakes us up
+static void power_idle()
+{
+	cli();
+	if (!sched_ready()) {
+		sleep_enable();
+		// instruction after sei runs before any interrupt
+		sei();
+		sleep_cpu();
+		sleep_disable();
+	}
+	sei();
+}
+
+ISR(INT0_vect)
+{
+	button_isr(button0);
+}
+
+ISR(INT1_vect)
+{
+	button_isr(button1);
 }
 
 ISR(INT2_vect)
 {
-	if (button_unknown == desk_button_pressed(button2))
-		stop_playback();
-	else
-		start_playback();
+	button_isr(button2);
 }
 
 int main()
 {
+#if SAMPLE_ASM
+	// registers are not cleared by reset, C mixer owns the voices
+	s_fast_scale = 0;
+	s_fast_cursor = 0;
+#endif
+
 	// init io ports
 	init_io_ports();
 
 	// init sampler and leds timer
 	timer1_init();
+#if SAMPLE_ASM
+	timer0_init();
+#endif
 
 	// init external interrupts
 	external_int_init();
 
+	// uploaded patterns and press clip
+	nvm_init();
+
+#if ASSET_BUNDLE
+	// clips and patterns in flash
+	bundle_sound();
+#endif
+
 	// init leds
-	desk_init_leds(&hw_fire_leds);
+	desk_init_leds(&leds_show);
+
+#if SPI_FLASH
+	// find tracks on serial flash
+	s_tracks_num = stream_init();
+#endif
+
+#if SAVE_STATE
+	// mode, speed and playback of the last power cycle
+	restore_state();
+#endif
+
+#if UART_STREAM || UART_UPLOAD || TELEMETRY
+	// pcm or uploads from host, telemetry to host
+	uart_init();
+#endif
+
+#if TELEMETRY
+	// why we are here, then clear reset flags (p.42)
+	tm_log(tm_boot, MCUCSR & 0x1f);
+	MCUCSR &= ~0x1f;
+#endif
+
+	// main loop tasks
+	sched_init(s_tasks, TASKS_NUM);
+	sched_add(task_anim, anim_task);
+	// restored mode goes on
+	sched_wake(task_anim);
+	sched_add(task_debounce, debounce_task);
+#if SAVE_STATE
+	sched_add(task_save, save_task);
+	sched_every(task_save, 1000 / CB_RATE);
+#endif
+#if TELEMETRY
+	sched_add(task_telemetry, telemetry_task);
+	sched_every(task_telemetry, 1000);
+#endif
+#if SPECTRUM
+	sched_add(task_spectrum, spectrum_task);
+	sched_every(task_spectrum, SPECTRUM_MS);
+#endif
+#if BEAT_MAP
+	sched_add(task_beat, beat_task);
+#endif
+	set_sleep_mode(SLEEP_MODE_IDLE);
 
 	// enable global interrupts
 	sei();
 
 	// loop forever
-	while(1)
-		;
+	while(1) {
+#if SPI_FLASH
+		// prefetch streamed samples
+		stream_poll();
+#endif
+#if UART_STREAM
+		// host started streaming, play it instead of clips
+		if (uart_stream_ready()) {
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+				start_clip(UART_CLIP);
+			}
+		}
+#endif
+#if UART_UPLOAD
+		// patterns and press clip from host
+		upload_poll();
+#endif
+		// timers and tasks, sleep if nothing was ready
+		if (!sched_run())
+			power_idle();
+	}
 
 	return 0;
 }
@@ -0,0 +1,192 @@
+#include <stddef.h>
+#include <string.h>
+#include <avr/interrupt.h>
+#include <avr/eeprom.h>
+#include <util/atomic.h>
+#include <util/crc16.h>
+
+#include "nvm.h"
+
+// bytes skipped per EE_RDY interrupt, bounds its time
+#define SKIP_MAX 8
+
+static nvm_header_t s_header;
+
+// write in progress
+static const uint8_t* s_wr_src;
+static uint16_t s_wr_addr;
+static volatile uint8_t s_wr_len;
+
+// newest log slot
+static nvm_slot_t s_slot;
+static uint8_t s_slot_n = NVM_LOG_SLOTS - 1;
+
+uint8_t nvm_init()
+{
+	nvm_header_t hdr;
+	uint16_t crc = 0;
+
+	for (uint8_t i = 0; i < sizeof(hdr); ++i)
+		((uint8_t*)&hdr)[i] = nvm_read(NVM_IMAGE + i);
+	if (hdr.magic != NVM_MAGIC || hdr.version != NVM_VERSION ||
+		hdr.length < sizeof(hdr) || hdr.length > NVM_IMAGE_SIZE)
+		memset(&hdr, 0, sizeof(hdr));
+
+	for (uint16_t i = sizeof(hdr); i < hdr.length; ++i)
+		crc = _crc_xmodem_update(crc, nvm_read(NVM_IMAGE + i));
+	if (crc != hdr.crc)
+		memset(&hdr, 0, sizeof(hdr));
+
+	// header is used by ISRs
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		s_header = hdr;
+	}
+
+	return hdr.magic != 0;
+}
+
+void nvm_reset()
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		memset(&s_header, 0, sizeof(s_header));
+	}
+}
+
+uint16_t nvm_pattern(uint8_t n)
+{
+	return s_header.patterns[n];
+}
+
+uint16_t nvm_clip(uint16_t* length)
+{
+	*length = s_header.clip_length;
+	return s_header.clip;
+}
+
+uint8_t nvm_ready()
+{
+	return !(EECR & (1 << EEWE));
+}
+
+uint8_t nvm_read_isr(uint16_t addr)
+{
+	uint16_t ear = EEAR;
+	uint8_t edr = EEDR;
+	uint8_t b;
+
+	// read strobe, CPU is halted for 4 cycles (p.20)
+	EEAR = addr;
+	EECR |= (1 << EERE);
+	b = EEDR;
+
+	EEAR = ear;
+	EEDR = edr;
+
+	return b;
+}
+
+uint8_t nvm_idle()
+{
+	return !s_wr_len && nvm_ready();
+}
+
+// writes are started from the main loop only, so nothing can
+// start one while we are reading, callers wait for nvm_idle()
+uint8_t nvm_read(uint16_t addr)
+{
+	return eeprom_read_byte((const uint8_t*)addr);
+}
+
+#if UART_UPLOAD || SAVE_STATE
+uint8_t nvm_write(uint16_t addr, const void* src, uint8_t len)
+{
+	if (s_wr_len)
+		return 0;
+	s_wr_src = src;
+	s_wr_addr = addr;
+	s_wr_len = len;
+
+	// fires as long as EEWE is clear (p.20)
+	EECR |= (1 << EERIE);
+	return 1;
+}
+
+ISR(EE_RDY_vect)
+{
+	uint8_t skip = SKIP_MAX;
+
+	while (s_wr_len && skip--) {
+		uint8_t b = *s_wr_src++;
+
+		EEAR = s_wr_addr++;
+		--s_wr_len;
+		EECR |= (1 << EERE);
+		if (EEDR == b)
+			continue;
+
+		// EEWE within 4 cycles after EEMWE, two SBIs
+		EEDR = b;
+		EECR |= (1 << EEMWE);
+		EECR |= (1 << EEWE);
+		return;
+	}
+	if (!s_wr_len)
+		EECR &= ~(1 << EERIE);
+}
+#endif
+
+#if SAVE_STATE
+static uint8_t slot_check(const nvm_slot_t* slot)
+{
+	const uint8_t* p = (const uint8_t*)slot;
+	uint8_t sum = 0;
+
+	for (uint8_t i = 0; i < offsetof(nvm_slot_t, check); ++i)
+		sum += p[i];
+	// erased slot is all 0xff, so it never passes
+	return ~sum;
+}
+
+uint8_t nvm_state_load(nvm_state_t* state)
+{
+	uint8_t found = 0;
+
+	for (uint8_t n = 0; n < NVM_LOG_SLOTS; ++n) {
+		nvm_slot_t slot;
+
+		for (uint8_t i = 0; i < sizeof(slot); ++i)
+			((uint8_t*)&slot)[i] = nvm_read(NVM_LOG + n * sizeof(slot) + i);
+		if (slot.check != slot_check(&slot))
+			continue;
+		// valid slots are within NVM_LOG_SLOTS sequence numbers,
+		// so the newest is found despite wrapping
+		if (found && (int8_t)(slot.seq - s_slot.seq) <= 0)
+			continue;
+		s_slot = slot;
+		s_slot_n = n;
+		found = 1;
+	}
+	if (found)
+		*state = s_slot.state;
+
+	return found;
+}
+
+uint8_t nvm_state_save(const nvm_state_t* state)
+{
+	uint8_t n = (s_slot_n + 1) % NVM_LOG_SLOTS;
+
+	if (!memcmp(state, &s_slot.state, sizeof(*state)))
+		return 1;
+	if (!nvm_idle())
+		return 0;
+
+	// s_slot is the source of the write till it is done
+	++s_slot.seq;
+	s_slot.state = *state;
+	s_slot.check = slot_check(&s_slot);
+	s_slot_n = n;
+
+	return nvm_write(NVM_LOG + n * sizeof(s_slot), &s_slot, sizeof(s_slot));
+}
+#endif
@@ -0,0 +1,96 @@
+#ifndef NVM_H
+#define NVM_H
+
+#include <avr/io.h>
+
+/*
+ * EEPROM layout, 512 bytes
+ *
+ *   0x000 .. 0x17f  content image, tools/ledupload.py
+ *   0x180 .. 0x1ff  state log, 16 slots of nvm_slot_t
+ *
+ * Content image starts with nvm_header_t, crc is CRC-XMODEM of the
+ * image after the header, so a half written image is never used.
+ * Patterns are
+ *
+ *   u8 frames number, then frames of { u8 layer, u16 leds }
+ *
+ * the same as built-in ones in flash, see fedordesk.c. Layer byte
+ * bits 3..7 are beats the frame lasts after the first one. Clip is
+ * 8-bit unsigned 8kHz pcm played on a button press.
+ *
+ * State log (SAVE_STATE=1) spreads writes over its slots, each save
+ * goes to the slot after the newest one with the next sequence
+ * number. A slot torn by power loss fails its check byte, so the
+ * previous one is used.
+ *
+ * EEPROM is written only by the EE_RDY interrupt, a byte per 8.5ms,
+ * unchanged bytes are skipped (p.20). Main loop reads don't wait for
+ * it, a slot takes up to ~68ms, callers retry once nvm_idle().
+ */
+
+#define NVM_IMAGE       0x000
+#define NVM_IMAGE_SIZE  0x180
+
+#define NVM_LOG         0x180
+#define NVM_LOG_SLOTS   16
+
+#define NVM_MAGIC       0x4446 // "FD"
+#define NVM_VERSION     1
+
+typedef struct nvm_header {
+	uint16_t magic;
+	uint8_t  version;
+	uint8_t  reserved;
+	uint16_t length;      // whole image
+	uint16_t crc;
+	uint16_t patterns[3]; // per button, 0 is built-in
+	uint16_t clip;        // 0 is built-in
+	uint16_t clip_length;
+} nvm_header_t;
+
+// what is restored after power up
+typedef struct nvm_state {
+	uint8_t  button;
+	uint8_t  speed;
+	uint8_t  playing;
+	uint8_t  clip;        // clip to resume
+	uint16_t pos;
+} nvm_state_t;
+
+typedef struct nvm_slot {
+	uint8_t     seq;
+	nvm_state_t state;
+	uint8_t     check;    // ~sum of the bytes above
+} nvm_slot_t;
+
+// validate and cache image header, 0 if there is no valid image,
+// when nvm_idle()
+uint8_t nvm_init();
+// forget the image, e.g. while it is being rewritten
+void nvm_reset();
+
+// EEPROM offsets, 0 if not uploaded
+uint16_t nvm_pattern(uint8_t n);
+uint16_t nvm_clip(uint16_t* length);
+
+// EEPROM is not being written
+uint8_t nvm_ready();
+// safe to call from ISR when nvm_ready(), keeps EEAR/EEDR of an
+// interrupted main loop access
+uint8_t nvm_read_isr(uint16_t addr);
+// main loop, when nvm_idle()
+uint8_t nvm_read(uint16_t addr);
+
+// main loop, start writing, 0 if the writer is busy, src
+// must stay intact till nvm_idle()
+uint8_t nvm_write(uint16_t addr, const void* src, uint8_t len);
+uint8_t nvm_idle();
+
+// newest state of the log, 0 if there is none, reads the
+// NVM_LOG_SLOTS slots only, when nvm_idle()
+uint8_t nvm_state_load(nvm_state_t* state);
+// main loop, 0 if the writer is busy, unchanged state is not written
+uint8_t nvm_state_save(const nvm_state_t* state);
+
+#endif //NVM_H
@@ -0,0 +1,45 @@
+#include <avr/interrupt.h>
+
+#include "sample.h"
+
+/*
+ * mix = (s - 0x80) * scale >> 7 of the C mixer is computed unsigned
+ * as (s * scale >> 7) - scale, s * scale fits 15 bits, so output is
+ * the same to the bit. See sample.h for registers.
+ */
+ISR(TIMER1_COMPA_vect, ISR_NAKED)
+{
+	__asm__ __volatile__ (
+		"    in   r2, __SREG__\n"
+#if ISR_PROBE
+		"    sbi  %[portd], 6\n"
+#endif
+		"    tst  r3\n"
+		"    breq 2f\n"
+		"    movw r8, r30\n"
+		"    movw r10, r0\n"
+		"    movw r30, r4\n"
+		"    lpm  r0, Z+\n"
+		"    mul  r0, r3\n"
+		"    lsl  r0\n"
+		"    rol  r1\n"
+		"    add  r1, r12\n"
+		"    out  %[ocr2], r1\n"
+		// end of clip, C mixer wraps or stops it
+		"    cp   r30, r6\n"
+		"    cpc  r31, r7\n"
+		"    brne 1f\n"
+		"    clr  r3\n"
+		"1:  movw r4, r30\n"
+		"    movw r0, r10\n"
+		"    movw r30, r8\n"
+#if ISR_PROBE
+		"    cbi  %[portd], 6\n"
+#endif
+		"    out  __SREG__, r2\n"
+		"    reti\n"
+		"2:  out  __SREG__, r2\n"
+		"    jmp  __vector_sample\n"
+		:: [ocr2] "I" (_SFR_IO_ADDR(OCR2)),
+		   [portd] "I" (_SFR_IO_ADDR(PORTD)));
+}
@@ -0,0 +1,37 @@
+#ifndef SAMPLE_H
+#define SAMPLE_H
+
+#include <avr/io.h>
+
+/*
+ * Naked sample ISR, SAMPLE_ASM=1.
+ *
+ * While the theme clip plays from flash alone at a steady gain, the
+ * main.c mixer arms the fast path: the clip cursor stays in reserved
+ * registers and TIMER1_COMPA_vect only fetches the next byte with
+ * LPM Z+, scales it and writes OCR2, ~30 cycles with the ISR entry.
+ * Anything else, or the end of the clip, goes to the C mixer, which
+ * takes the cursor back first.
+ *
+ * Every object is built with -ffixed for these, see Makefile, and
+ * tools/regcheck.py fails the build if library code touches them:
+ *   r2      SREG
+ *   r3      scale, Q1.7 volume times gain, 0 is the C path
+ *   r4:r5   cursor, 0 if the C mixer owns the position
+ *   r6:r7   clip end
+ *   r8:r9   Z
+ *   r10:r11 r0:r1
+ *   r12     0x80 - scale
+ */
+
+#if SAMPLE_ASM
+register uint8_t s_fast_scale asm("r3");
+register const uint8_t* s_fast_cursor asm("r4");
+register const uint8_t* s_fast_end asm("r6");
+register uint8_t s_fast_offset asm("r12");
+
+// C mixer, jumped to from the naked ISR
+#define SAMPLE_C_vect __vector_sample
+#endif
+
+#endif //SAMPLE_H
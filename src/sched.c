@@ -0,0 +1,160 @@
+#include <util/atomic.h>
+
+#include "sched.h"
+
+static task_t* s_tasks;
+static uint8_t s_tasks_num;
+// first timer to expire
+static uint8_t s_head = SCHED_END;
+// written by ISRs
+static volatile uint8_t s_ready;
+static volatile uint8_t s_ticks;
+// ms consumed by sched_run()
+static uint16_t s_now;
+// delta of the head as of s_ticks, for sched_next() in the tick ISR
+static volatile uint16_t s_head_delta = 0xffff;
+
+// head changed
+static void sched_publish()
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		s_head_delta = s_head == SCHED_END ? 0xffff : s_tasks[s_head].delta;
+	}
+}
+
+static void sched_insert(uint8_t id, uint16_t ms)
+{
+	uint8_t* link = &s_head;
+
+	// after timers expiring earlier or at the same time
+	while (*link != SCHED_END && s_tasks[*link].delta <= ms) {
+		ms -= s_tasks[*link].delta;
+		link = &s_tasks[*link].next;
+	}
+	s_tasks[id].delta = ms;
+	s_tasks[id].next = *link;
+	if (*link != SCHED_END)
+		s_tasks[*link].delta -= ms;
+	*link = id;
+}
+
+void sched_init(task_t* tasks, uint8_t num)
+{
+	s_tasks = tasks;
+	s_tasks_num = num;
+}
+
+void sched_add(uint8_t id, task_fn_t fn)
+{
+	s_tasks[id].fn = fn;
+	s_tasks[id].pt = 0;
+	s_tasks[id].period = 0;
+	s_tasks[id].next = SCHED_IDLE;
+}
+
+void sched_cancel(uint8_t id)
+{
+	uint8_t* link = &s_head;
+
+	if (s_tasks[id].next == SCHED_IDLE)
+		return;
+	while (*link != id)
+		link = &s_tasks[*link].next;
+	*link = s_tasks[id].next;
+	// the rest keeps its expiry
+	if (*link != SCHED_END)
+		s_tasks[*link].delta += s_tasks[id].delta;
+	s_tasks[id].next = SCHED_IDLE;
+	sched_publish();
+}
+
+void sched_every(uint8_t id, uint16_t ms)
+{
+	sched_cancel(id);
+	s_tasks[id].period = ms;
+	sched_insert(id, ms);
+	sched_publish();
+}
+
+void sched_after(uint8_t id, uint16_t ms)
+{
+	sched_cancel(id);
+	s_tasks[id].period = 0;
+	sched_insert(id, ms);
+	sched_publish();
+}
+
+uint8_t sched_pending(uint8_t id)
+{
+	return s_tasks[id].next != SCHED_IDLE;
+}
+
+void sched_wake(uint8_t id)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		s_ready |= 1 << id;
+	}
+}
+
+void sched_tick()
+{
+	// main loop is 255ms late, lose time rather than wrap
+	if (s_ticks != 0xff)
+		++s_ticks;
+}
+
+uint8_t sched_run()
+{
+	uint8_t ticks, ready = 0, id;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		ticks = s_ticks;
+		s_ticks = 0;
+		// counted into the head below
+		s_head_delta -= s_head_delta > ticks ? ticks : s_head_delta;
+	}
+	s_now += ticks;
+
+	while (ticks-- && s_head != SCHED_END) {
+		if (--s_tasks[s_head].delta)
+			continue;
+		// expired, timers of the same ms follow with 0
+		do {
+			id = s_head;
+			s_head = s_tasks[id].next;
+			s_tasks[id].next = SCHED_IDLE;
+			ready |= 1 << id;
+			if (s_tasks[id].period)
+				sched_insert(id, s_tasks[id].period);
+		} while (s_head != SCHED_END && !s_tasks[s_head].delta);
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		ready |= s_ready;
+		s_ready = 0;
+	}
+
+	for (id = 0; id < s_tasks_num; ++id)
+		if (ready & (1 << id))
+			s_tasks[id].fn(&s_tasks[id].pt);
+	sched_publish();
+
+	return ready;
+}
+
+uint16_t sched_now()
+{
+	return s_now;
+}
+
+uint16_t sched_next()
+{
+	uint16_t delta = s_head_delta;
+
+	return delta > s_ticks ? delta - s_ticks : 0;
+}
+
+uint8_t sched_ready()
+{
+	return s_ready || s_ticks;
+}
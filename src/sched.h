@@ -0,0 +1,77 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <avr/io.h>
+
+/*
+ * Cooperative scheduler of the main loop.
+ *
+ * Tasks are plain functions, or protothreads: stackless, a task
+ * waits by returning and resumes at the saved line, so locals don't
+ * survive a wait. They are run by sched_run() when woken: by their
+ * timer or by sched_wake(), which is the only call for ISRs.
+ *
+ * Timers are a delta list ordered by expiry, each entry holds ms
+ * after the previous one, so a 1ms tick decrements the head only,
+ * O(1) however many timers are armed. Periodic timers are re-armed
+ * on expiry relative to it, they don't drift.
+ *
+ * RAM is 9 bytes per task in the caller's array plus 10 bytes here,
+ * i.e. 64 bytes with all the tasks of main.c, no stack of its own.
+ */
+
+#define SCHED_RATE 1000 // tick rate, hz
+
+typedef uint16_t pt_t;
+
+typedef void (*task_fn_t)(pt_t* pt);
+
+typedef struct task {
+	task_fn_t fn;
+	pt_t      pt;      // line to resume at, 0 is the start
+	uint16_t  delta;   // ms after the previous timer of the list
+	uint16_t  period;  // ms, 0 is one-shot
+	uint8_t   next;    // next timer, SCHED_END or SCHED_IDLE
+} task_t;
+
+#define SCHED_END  0xff // last timer of the list
+#define SCHED_IDLE 0xfe // no timer armed
+
+// protothread, see task_fn_t
+#define PT_BEGIN(pt)         switch (*(pt)) { case 0:
+#define PT_WAIT_UNTIL(pt, c) do { *(pt) = __LINE__; case __LINE__: \
+	if (!(c)) return; } while (0)
+#define PT_WAIT_WHILE(pt, c) PT_WAIT_UNTIL(pt, !(c))
+#define PT_END(pt)           } *(pt) = 0
+
+// up to 8 tasks
+void sched_init(task_t* tasks, uint8_t num);
+void sched_add(uint8_t id, task_fn_t fn);
+
+// timers, ms > 0, re-arming replaces the pending one
+void sched_every(uint8_t id, uint16_t ms);
+void sched_after(uint8_t id, uint16_t ms);
+void sched_cancel(uint8_t id);
+uint8_t sched_pending(uint8_t id);
+
+// any context
+void sched_wake(uint8_t id);
+
+// tick ISR, every 1 / SCHED_RATE
+void sched_tick();
+
+// main loop, runs woken tasks, returns 0 if none was
+uint8_t sched_run();
+
+// main loop, ms clock of the ticks run so far, wraps every 65s,
+// differences of two readings are elapsed time
+uint16_t sched_now();
+
+// interrupts disabled, a task is woken or a tick is pending
+uint8_t sched_ready();
+
+// tick ISR, ms till the first timer expires, 0xffff if none is
+// armed, so the ISR can sleep through the ticks before it
+uint16_t sched_next();
+
+#endif //SCHED_H
@@ -0,0 +1,49 @@
+#ifndef SOUND_H
+#define SOUND_H
+
+#include <avr/io.h>
+
+/*
+ * Sound bank.
+ *
+ * All clips live in one PROGMEM pool (s_samples), clips are
+ * described by offset and length into the pool, so clips can
+ * share the same bytes. Pool and clip table are generated by
+ * tools/sndpack.py into sounddata.h. With SAMPLES_LZ=1 the pool is
+ * s_lz instead, packed by blocks, see lz.h, offsets are the same.
+ *
+ * Cue points are pool offsets of note onsets, clip cues are
+ * s_cues[cue .. cue + cues_num), the first one is the clip start.
+ *
+ * Beats are led frames keyed to pool offsets, clip beats are
+ * s_beats[beat .. beat + beats_num), sorted, the first one is the
+ * clip start. The sample ISR shows a beat when the theme reaches its
+ * offset, BEAT_MAP=1, see main.c.
+ */
+
+#define CLIP_LOOP   (1 << 0)
+
+// status of streamed sample sources
+enum {
+	stream_ok = 0,
+	stream_underrun,
+	stream_eof
+};
+
+typedef struct clip {
+	uint16_t offset;
+	uint16_t length;
+	uint8_t  cue;
+	uint8_t  cues_num;
+	uint16_t beat;
+	uint8_t  beats_num;
+	uint8_t  flags;
+} clip_t;
+
+typedef struct beat {
+	uint16_t pos;
+	uint8_t  layer;
+	uint16_t leds;
+} beat_t;
+
+#endif //SOUND_H
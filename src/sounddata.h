@@ -6,10 +6,973 @@
 // convert mp3 to raw pcm:
 //   $ sox file.mp3 -c1 -r8000 -e unsigned -b 8 out.raw
 // get only 14 kbytes:
-//   $ dd if=out.raw of=pcm count=14 bs=1024
+//   $ dd if=out.raw of=theme.raw count=14 bs=1024
+// generate coin effect:
+//   $ sfxgen.py -o coin.raw 988:80 1319:112
 // generate C header:
-//   $ xxd -i pcm >> soundata.h
+//   $ sndpack.py -o sounddata.h theme=theme.raw@0+12800,loop phrase=theme.raw@5632+7168,loop intro=theme.raw@2048+2816 coin=coin.raw
 
+#include <avr/pgmspace.h>
+
+#include "sound.h"
+
+#define CLIP_THEME      0
+#define CLIP_PHRASE     1
+#define CLIP_INTRO      2
+#define CLIP_COIN       3
+#define CLIPS_NUM       4
+
+#if SAMPLES_LZ
+// pool of 14336 bytes, packed, see lz.h
+const unsigned char s_lz[] PROGMEM = {
+  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
+  0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
+  0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f,
+  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f,
+  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
+  0x7f, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80,
+  0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x80,
+  0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
+  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x7f, 0x00,
+  0x85, 0x82, 0x00, 0x8b, 0x84, 0x00, 0x82, 0x39, 0x00, 0x86, 0x3c, 0x00,
+  0x81, 0x16, 0x00, 0x03, 0x81, 0x80, 0x81, 0x7f, 0x81, 0x42, 0x00, 0x8a,
+  0x99, 0x00, 0x81, 0x27, 0x00, 0x83, 0x27, 0x00, 0x00, 0x81, 0x84, 0x73,
+  0x00, 0x89, 0x7c, 0x00, 0x83, 0x3c, 0x00, 0x00, 0x81, 0x83, 0x65, 0x00,
+  0x83, 0x5e, 0x00, 0x82, 0x45, 0x00, 0x82, 0x4a, 0x00, 0x83, 0x42, 0x00,
+  0x85, 0x95, 0x00, 0x88, 0x7c, 0x00, 0x86, 0x8c, 0x00, 0x81, 0x4f, 0x00,
+  0x84, 0x99, 0x00, 0x88, 0xa1, 0x00, 0x82, 0x6a, 0x00, 0x85, 0x63, 0x00,
+  0x84, 0xcd, 0x00, 0x83, 0xa0, 0x00, 0x83, 0xa1, 0x00, 0x83, 0x74, 0x00,
+  0x03, 0x81, 0x80, 0x80, 0x81, 0x84, 0xa4, 0x00, 0x85, 0xea, 0x00, 0x85,
+  0xed, 0x00, 0x81, 0x83, 0x00, 0x02, 0x81, 0x80, 0x80, 0x01, 0x81, 0x7f,
+  0x81, 0x94, 0x00, 0x81, 0xe6, 0x00, 0x86, 0x01, 0x01, 0x86, 0x04, 0x01,
+  0x84, 0x97, 0x00, 0x85, 0xd8, 0x00, 0x88, 0x0c, 0x01, 0x01, 0x81, 0x81,
+  0x85, 0xf8, 0x00, 0x85, 0xda, 0x00, 0x83, 0x9f, 0x00, 0x83, 0xb0, 0x00,
+  0x81, 0xb0, 0x00, 0x88, 0xfb, 0x00, 0x85, 0xf6, 0x00, 0x81, 0x44, 0x00,
+  0x85, 0xf7, 0x00, 0x85, 0xb6, 0x00, 0x00, 0x81, 0x83, 0xc6, 0x00, 0x83,
+  0xd9, 0x00, 0x84, 0xc1, 0x00, 0x00, 0x81, 0x85, 0x17, 0x01, 0x8b, 0x41,
+  0x01, 0x82, 0xfc, 0x00, 0x84, 0xd2, 0x00, 0x82, 0xe3, 0x00, 0x83, 0xdd,
+  0x00, 0x00, 0x81, 0x84, 0x20, 0x01, 0x86, 0x25, 0x01, 0x85, 0x57, 0x01,
+  0x84, 0x12, 0x01, 0x86, 0x5e, 0x01, 0x86, 0x38, 0x01, 0x85, 0x63, 0x01,
+  0x82, 0x17, 0x01, 0x81, 0xf3, 0x00, 0x81, 0xfe, 0x00, 0x86, 0x70, 0x01,
+  0x84, 0x2a, 0x01, 0x82, 0x2b, 0x01, 0x81, 0x0a, 0x01, 0x86, 0x7c, 0x01,
+  0x87, 0x51, 0x01, 0x81, 0x09, 0x01, 0x84, 0x53, 0x01, 0x85, 0x5c, 0x01,
+  0x00, 0x7f, 0x81, 0x1e, 0x01, 0x85, 0x21, 0x01, 0x03, 0x7f, 0x80, 0x80,
+  0x7f, 0x81, 0x29, 0x01, 0x83, 0x35, 0x01, 0x85, 0x82, 0x01, 0x00, 0x7f,
+  0x84, 0x71, 0x01, 0x86, 0x75, 0x01, 0x82, 0x3b, 0x01, 0x85, 0x3b, 0x01,
+  0x86, 0x82, 0x01, 0x00, 0x81, 0x81, 0x9d, 0x01, 0x85, 0x46, 0x01, 0x86,
+  0x8f, 0x01, 0x83, 0x68, 0x01, 0x85, 0xbf, 0x01, 0x85, 0x92, 0x01, 0x87,
+  0x50, 0x01, 0x83, 0x51, 0x01, 0x82, 0x65, 0x01, 0x00, 0x81, 0x85, 0x95,
+  0x01, 0x85, 0xd3, 0x01, 0x86, 0xae, 0x01, 0x84, 0xad, 0x01, 0x86, 0xdd,
+  0x01, 0x81, 0x4c, 0x00, 0x86, 0xe3, 0x01, 0x85, 0xe5, 0x01, 0x87, 0xba,
+  0x01, 0x85, 0xeb, 0x01, 0x02, 0x80, 0x80, 0x7f, 0x81, 0x0f, 0x01, 0x83,
+  0x7d, 0x01, 0x88, 0x84, 0x01, 0x87, 0xfc, 0x01, 0x86, 0xff, 0x01, 0x85,
+  0xdd, 0x01, 0x81, 0x71, 0x00, 0x83, 0x8e, 0x01, 0x81, 0x77, 0x00, 0x85,
+  0x9d, 0x01, 0x83, 0xdd, 0x01, 0x00, 0x81, 0x83, 0xd2, 0x01, 0x84, 0xce,
+  0x01, 0x82, 0x06, 0x02, 0x88, 0xf1, 0x01, 0x86, 0xb2, 0x01, 0x87, 0xde,
+  0x01, 0x83, 0xdb, 0x01, 0x8b, 0x00, 0x02, 0x86, 0x03, 0x02, 0x82, 0xb8,
+  0x01, 0x83, 0xbb, 0x01, 0x00, 0x7f, 0x82, 0x12, 0x02, 0x85, 0x03, 0x02,
+  0x86, 0x16, 0x02, 0x83, 0xd1, 0x01, 0x81, 0xd6, 0x01, 0x00, 0x81, 0x83,
+  0xfd, 0x01, 0x83, 0x38, 0x02, 0x83, 0xe3, 0x01, 0x00, 0x81, 0x85, 0x27,
+  0x02, 0x83, 0xec, 0x01, 0x83, 0x17, 0x02, 0x86, 0x5e, 0x02, 0x00, 0x7f,
+  0x81, 0x4c, 0x02, 0x89, 0x39, 0x02, 0x86, 0x00, 0x02, 0x00, 0x7f, 0x82,
+  0x07, 0x02, 0x83, 0xf9, 0x01, 0x81, 0xfb, 0x01, 0x82, 0x2c, 0x02, 0x81,
+  0x0b, 0x02, 0x81, 0x99, 0x01, 0x83, 0x10, 0x02, 0x00, 0x81, 0x82, 0x5e,
+  0x02, 0x81, 0x61, 0x02, 0x81, 0x1c, 0x02, 0x83, 0x48, 0x02, 0x83, 0x44,
+  0x02, 0x02, 0x80, 0x80, 0x7f, 0x81, 0x29, 0x02, 0x82, 0x86, 0x02, 0x84,
+  0x73, 0x02, 0x84, 0x42, 0x02, 0x87, 0x9e, 0x02, 0x83, 0x31, 0x02, 0x82,
+  0x8d, 0x02, 0x81, 0x19, 0x01, 0x82, 0x60, 0x02, 0x81, 0x9c, 0x02, 0x86,
+  0x72, 0x02, 0x83, 0x3f, 0x02, 0x81, 0x43, 0x02, 0x85, 0x8d, 0x02, 0x86,
+  0x52, 0x02, 0x85, 0x76, 0x02, 0x83, 0x4f, 0x02, 0x01, 0x7f, 0x7f, 0x81,
+  0x5f, 0x02, 0x00, 0x7f, 0x81, 0xbc, 0x02, 0x00, 0x81, 0x81, 0x83, 0x02,
+  0x82, 0x65, 0x02, 0x81, 0xfa, 0x01, 0x82, 0x73, 0x02, 0x82, 0x9c, 0x02,
+  0x81, 0x53, 0x01, 0x81, 0x7b, 0x02, 0x84, 0xbb, 0x02, 0x84, 0xc3, 0x02,
+  0x00, 0x7f, 0x84, 0xbb, 0x02, 0x86, 0xc9, 0x02, 0x00, 0x81, 0x81, 0xe6,
+  0x02, 0x86, 0xc3, 0x02, 0x85, 0x02, 0x03, 0x84, 0x96, 0x02, 0x81, 0x90,
+  0x02, 0x84, 0xda, 0x02, 0x85, 0x9a, 0x02, 0x81, 0xbd, 0x02, 0x88, 0xe7,
+  0x02, 0x85, 0xeb, 0x02, 0x01, 0x81, 0x81, 0x84, 0xec, 0x02, 0x03, 0x80,
+  0x80, 0x81, 0x81, 0x81, 0xc5, 0x02, 0x86, 0x29, 0x03, 0x83, 0xf2, 0x02,
+  0x00, 0x7f, 0x82, 0x19, 0x03, 0x81, 0xe2, 0x02, 0x84, 0x05, 0x03, 0x85,
+  0x39, 0x03, 0x85, 0x3c, 0x03, 0x82, 0xcf, 0x02, 0x86, 0x43, 0x03, 0x85,
+  0x15, 0x03, 0x83, 0xd1, 0x02, 0x84, 0x31, 0x03, 0x00, 0x81, 0x83, 0x34,
+  0x03, 0x01, 0x81, 0x81, 0x85, 0x1b, 0x03, 0x81, 0xee, 0x02, 0x81, 0x08,
+  0x03, 0x86, 0x32, 0x03, 0x81, 0xf4, 0x02, 0x02, 0x81, 0x81, 0x80, 0x83,
+  0x23, 0x03, 0x85, 0x5d, 0x03, 0x85, 0xff, 0x02, 0x81, 0x51, 0x00, 0x84,
+  0x4b, 0x03, 0x85, 0x69, 0x03, 0x85, 0x7b, 0x03, 0x87, 0x09, 0x03, 0x84,
+  0x67, 0x03, 0x81, 0x30, 0x03, 0x01, 0x7f, 0x81, 0x87, 0x7d, 0x03, 0x83,
+  0x41, 0x03, 0x87, 0x1b, 0x03, 0x84, 0x62, 0x03, 0x8b, 0x6c, 0x03, 0x85,
+  0x99, 0x03, 0x00, 0x80, 0x85, 0x9e, 0x03, 0x88, 0x74, 0x03, 0x82, 0x47,
+  0x03, 0x85, 0x7c, 0x03, 0x83, 0x67, 0x03, 0x81, 0x1a, 0x02, 0x85, 0xb0,
+  0x03, 0x83, 0x3a, 0x03, 0x86, 0xb7, 0x03, 0x87, 0x8d, 0x03, 0x85, 0x8b,
+  0x03, 0x82, 0x53, 0x03, 0x00, 0x81, 0x81, 0x56, 0x03, 0x82, 0xb0, 0x03,
+  0x81, 0x7c, 0x03, 0x83, 0x83, 0x03, 0x81, 0x3d, 0x02, 0x84, 0xa1, 0x03,
+  0x84, 0x68, 0x03, 0x01, 0x81, 0x80, 0x82, 0x64, 0x03, 0x84, 0x81, 0x03,
+  0x84, 0xb8, 0x03, 0x82, 0x7f, 0x03, 0x82, 0x78, 0x03, 0x84, 0xba, 0x03,
+  0x86, 0xc4, 0x03, 0x01, 0x81, 0x7f, 0x81, 0x86, 0x03, 0x81, 0x7f, 0x03,
+  0x83, 0xa9, 0x03, 0x82, 0xd7, 0x03, 0x86, 0x01, 0x04, 0x85, 0x03, 0x04,
+  0x85, 0x06, 0x04, 0x84, 0x97, 0x03, 0x83, 0xba, 0x03, 0x82, 0xa2, 0x03,
+  0x87, 0xf6, 0x03, 0x85, 0x15, 0x04, 0x00, 0x80, 0x82, 0xad, 0x03, 0x00,
+  0x7f, 0x81, 0x09, 0x04, 0x81, 0xce, 0x03, 0x82, 0xb8, 0x03, 0x00, 0x7f,
+  0x81, 0x14, 0x04, 0x84, 0xce, 0x03, 0x86, 0x01, 0x04, 0x84, 0x2a, 0x04,
+  0x82, 0xec, 0x03, 0x4b, 0x7f, 0x80, 0x7f, 0x81, 0x7f, 0x81, 0x80, 0x81,
+  0x7e, 0x82, 0x77, 0x78, 0x76, 0x6e, 0x78, 0x72, 0x76, 0x74, 0x77, 0x7e,
+  0x7a, 0x7d, 0x7d, 0x80, 0x7b, 0x7d, 0x7f, 0x7a, 0x7b, 0x7f, 0x7a, 0x7b,
+  0x85, 0x83, 0x84, 0x7a, 0x7f, 0x7f, 0x84, 0x86, 0x7c, 0x87, 0x84, 0x8c,
+  0x8e, 0x92, 0x92, 0x89, 0x90, 0x91, 0x95, 0x96, 0x93, 0x8f, 0x94, 0x93,
+  0x94, 0x96, 0x9e, 0x9f, 0x95, 0x9f, 0x9d, 0x99, 0x9f, 0xa7, 0x80, 0x8a,
+  0x87, 0x7c, 0x81, 0x78, 0x82, 0x75, 0x7f, 0x6f, 0x7f, 0x77, 0x6c, 0x72,
+  0x73, 0x71, 0x73, 0x6f, 0x70, 0x6f, 0x71, 0x68, 0x66, 0x6b, 0x6f, 0x64,
+  0x6b, 0x60, 0x60, 0x6b, 0x6e, 0x73, 0x77, 0x7f, 0x8d, 0x80, 0x79, 0x7a,
+  0x81, 0x8b, 0x7f, 0x87, 0x88, 0x96, 0x92, 0x91, 0x94, 0xa1, 0x91, 0x8e,
+  0x9d, 0x8f, 0x9b, 0x93, 0x95, 0x93, 0x95, 0x8f, 0x8a, 0x87, 0x86, 0x85,
+  0x7f, 0x7b, 0x72, 0x73, 0x79, 0x73, 0x7b, 0x71, 0x65, 0x6f, 0x68, 0x69,
+  0x66, 0x73, 0x58, 0x3d, 0x3c, 0x37, 0x41, 0x4b, 0x46, 0x4a, 0x69, 0x84,
+  0x96, 0x8d, 0x8d, 0x8b, 0x7a, 0x7c, 0x85, 0x84, 0x86, 0x84, 0x7e, 0x89,
+  0x91, 0x9c, 0x82, 0x8b, 0x86, 0x72, 0x7f, 0x7b, 0x93, 0x9c, 0xba, 0xb1,
+  0xac, 0xad, 0x94, 0x9f, 0x88, 0x7e, 0x80, 0x69, 0x6c, 0x6d, 0x63, 0x7c,
+  0x71, 0x6e, 0x70, 0x73, 0x5d, 0x51, 0x72, 0x70, 0x73, 0x6f, 0x80, 0x91,
+  0x85, 0x7c, 0x7c, 0x84, 0x80, 0x7f, 0x55, 0x5b, 0x61, 0x68, 0x6c, 0x75,
+  0x94, 0x97, 0x89, 0x87, 0x91, 0x9b, 0x9a, 0x94, 0x91, 0x8a, 0x8f, 0x9c,
+  0xb0, 0xad, 0xb1, 0xb5, 0xa6, 0x86, 0x82, 0x7a, 0x79, 0x72, 0x82, 0x7b,
+  0x82, 0x8b, 0x89, 0xa3, 0x95, 0x96, 0x7c, 0x79, 0x6e, 0x73, 0x70, 0x70,
+  0x82, 0x70, 0x6b, 0x68, 0x69, 0x6c, 0x56, 0x54, 0x56, 0x51, 0x59, 0x5c,
+  0x8c, 0xa3, 0x95, 0x92, 0x91, 0x98, 0x8c, 0x8d, 0x7e, 0x7d, 0x8a, 0x6f,
+  0x83, 0x8f, 0x92, 0x8e, 0x98, 0x98, 0x88, 0x88, 0x8f, 0x95, 0x9b, 0xa8,
+  0xa4, 0xa9, 0xa9, 0xab, 0x9e, 0x9a, 0x90, 0x87, 0x7c, 0x61, 0x5e, 0x60,
+  0x6d, 0x71, 0x78, 0x7a, 0x67, 0x7d, 0x68, 0x5a, 0x77, 0x64, 0x71, 0x6c,
+  0x6d, 0x87, 0x7e, 0x7e, 0x87, 0x82, 0x72, 0x55, 0x59, 0x69, 0x6b, 0x75,
+  0x6a, 0x85, 0x92, 0x8b, 0x87, 0x9e, 0xa9, 0x90, 0x94, 0x93, 0x95, 0x97,
+  0x99, 0xa0, 0x7f, 0xab, 0xac, 0x94, 0x8f, 0x97, 0x88, 0x7e, 0x7c, 0x7f,
+  0x86, 0x6e, 0x7b, 0x88, 0x91, 0x94, 0x95, 0x9e, 0x69, 0x70, 0x67, 0x69,
+  0x65, 0x68, 0x72, 0x63, 0x6d, 0x60, 0x69, 0x68, 0x61, 0x4f, 0x59, 0x55,
+  0x5f, 0x69, 0x85, 0x9a, 0x91, 0x95, 0x98, 0x99, 0x8f, 0x85, 0x7d, 0x83,
+  0x7c, 0x76, 0x7c, 0x95, 0x9e, 0x93, 0x86, 0x8b, 0x88, 0x80, 0x86, 0x8f,
+  0x94, 0x9d, 0xa4, 0xa4, 0xaa, 0xa1, 0xa5, 0xa5, 0x8e, 0x85, 0x6b, 0x54,
+  0x61, 0x5d, 0x64, 0x6c, 0x75, 0x7b, 0x78, 0x6e, 0x77, 0x7c, 0x73, 0x6b,
+  0x65, 0x6d, 0x6e, 0x7e, 0x75, 0x78, 0x82, 0x74, 0x70, 0x66, 0x6d, 0x69,
+  0x65, 0x72, 0x70, 0x83, 0x91, 0x8e, 0x8e, 0x9e, 0xac, 0x98, 0x8c, 0x8b,
+  0x8d, 0x9b, 0x9b, 0x9f, 0xaa, 0xa6, 0x91, 0x92, 0x9e, 0x91, 0x82, 0x83,
+  0x7e, 0x7e, 0x80, 0x78, 0x85, 0x92, 0x8f, 0x83, 0x87, 0x82, 0x6b, 0x7f,
+  0x6e, 0x6e, 0x6c, 0x6f, 0x66, 0x71, 0x6a, 0x64, 0x67, 0x66, 0x6d, 0x65,
+  0x45, 0x53, 0x52, 0x6c, 0x73, 0x86, 0x94, 0x82, 0x92, 0x8b, 0x92, 0x7e,
+  0x86, 0x83, 0x7f, 0x72, 0x82, 0x92, 0x8e, 0x95, 0x95, 0x9b, 0xa5, 0x89,
+  0x89, 0x97, 0x8c, 0x9b, 0x97, 0xa3, 0xa0, 0xa6, 0xa4, 0xa1, 0x88, 0x77,
+  0x66, 0x64, 0x60, 0x61, 0x69, 0x68, 0x7d, 0x6c, 0x7e, 0x78, 0x7c, 0x7d,
+  0x66, 0x70, 0x70, 0x6a, 0x6e, 0x71, 0x7d, 0x7e, 0x7f, 0x6a, 0x69, 0x71,
+  0x64, 0x6e, 0x61, 0x77, 0x76, 0x77, 0x90, 0x9a, 0x9b, 0x9e, 0xa5, 0x93,
+  0x92, 0x91, 0x92, 0x8f, 0x96, 0x9c, 0xa7, 0x96, 0x8b, 0x9c, 0x9b, 0x92,
+  0x80, 0x83, 0x83, 0x82, 0x7b, 0x81, 0x9b, 0x94, 0x83, 0x89, 0x82, 0x7f,
+  0x84, 0x6d, 0x60, 0x6e, 0x5e, 0x5f, 0x5b, 0x63, 0x67, 0x68, 0x69, 0x65,
+  0x64, 0x5e, 0x5d, 0x61, 0x81, 0x72, 0x83, 0x8f, 0x7f, 0x91, 0x93, 0x97,
+  0x91, 0x82, 0x85, 0x79, 0x78, 0x7a, 0x7f, 0x86, 0x8b, 0x92, 0x9a, 0xa2,
+  0x99, 0x88, 0x94, 0x90, 0x9b, 0x9e, 0x97, 0x95, 0x9b, 0x9e, 0x9d, 0x9f,
+  0x86, 0x81, 0x78, 0x58, 0x67, 0x64, 0x60, 0x61, 0x6f, 0x7e, 0x70, 0x75,
+  0x81, 0x83, 0x6d, 0x6f, 0x6d, 0x6a, 0x76, 0x6a, 0x6d, 0x7c, 0x73, 0x5d,
+  0x6c, 0x79, 0x66, 0x67, 0x6e, 0x75, 0x81, 0x7b, 0x80, 0x9b, 0x97, 0x9d,
+  0xa5, 0x9b, 0x91, 0x8a, 0x8d, 0xa2, 0x89, 0x8a, 0x8e, 0x8f, 0x9b, 0x8f,
+  0xa2, 0x95, 0x85, 0x7e, 0x88, 0x7c, 0x78, 0x85, 0x96, 0xa1, 0x98, 0x96,
+  0x8f, 0x8c, 0x86, 0x76, 0x75, 0x74, 0x63, 0x62, 0x66, 0x71, 0x71, 0x6f,
+  0x6d, 0x6e, 0x6a, 0x59, 0x61, 0x6e, 0x72, 0x75, 0x79, 0x8a, 0x8f, 0x8d,
+  0x90, 0x90, 0x92, 0x7e, 0x74, 0x79, 0x7a, 0x7e, 0x82, 0x8e, 0x93, 0x94,
+  0x97, 0x96, 0xa0, 0x9b, 0x95, 0x7f, 0x99, 0x99, 0x9a, 0x95, 0x9c, 0x9d,
+  0x96, 0x94, 0x82, 0x7d, 0x71, 0x68, 0x69, 0x65, 0x68, 0x64, 0x6c, 0x73,
+  0x71, 0x7f, 0x7d, 0x7b, 0x72, 0x65, 0x67, 0x63, 0x66, 0x62, 0x6c, 0x73,
+  0x63, 0x68, 0x6b, 0x70, 0x6f, 0x65, 0x6e, 0x6f, 0x75, 0x75, 0x82, 0x9d,
+  0x9c, 0x9d, 0x9b, 0x9d, 0x9a, 0x8d, 0x90, 0x90, 0x95, 0x8d, 0x87, 0x97,
+  0x97, 0x99, 0x99, 0x98, 0x96, 0x83, 0x80, 0x7c, 0x82, 0x87, 0x80, 0x8c,
+  0x8a, 0x86, 0x83, 0x80, 0x7e, 0x70, 0x6a, 0x5f, 0x58, 0x5b, 0x58, 0x67,
+  0x6a, 0x68, 0x68, 0x67, 0x68, 0x5c, 0x65, 0x6c, 0x6d, 0x73, 0x73, 0x82,
+  0x8c, 0x8b, 0x8e, 0x8e, 0x90, 0x7f, 0x79, 0x7e, 0x7f, 0x84, 0x84, 0x8d,
+  0x96, 0x96, 0x97, 0x9a, 0xa6, 0xa1, 0x98, 0x9a, 0x9a, 0x9b, 0x97, 0x98,
+  0x9c, 0x97, 0x8d, 0x81, 0x80, 0x7a, 0x6d, 0x6c, 0x6a, 0x6b, 0x68, 0x69,
+  0x72, 0x78, 0x7f, 0x7f, 0x79, 0x7a, 0x75, 0x68, 0x67, 0x66, 0x65, 0x65,
+  0x66, 0x67, 0x66, 0x6a, 0x6e, 0x72, 0x75, 0x6e, 0x6e, 0x74, 0x76, 0x7c,
+  0x87, 0x97, 0x9a, 0x9b, 0x9b, 0x9b, 0x9c, 0x93, 0x8f, 0x94, 0x92, 0x8a,
+  0x8a, 0x95, 0x9a, 0x9b, 0x9c, 0x9a, 0x98, 0x8c, 0x81, 0x83, 0x88, 0x85,
+  0x81, 0x85, 0x89, 0x85, 0x82, 0x7f, 0x7d, 0x77, 0x65, 0x5e, 0x5e, 0x5e,
+  0x5d, 0x62, 0x6b, 0x69, 0x68, 0x68, 0x67, 0x6c, 0x69, 0x6a, 0x6e, 0x71,
+  0x75, 0x7b, 0x8a, 0x8b, 0x8d, 0x90, 0x87, 0x82, 0x7c, 0x7d, 0x80, 0x82,
+  0x86, 0x88, 0x95, 0x97, 0x98, 0xa3, 0xa5, 0xa5, 0x9b, 0x98, 0x9c, 0x99,
+  0x98, 0x93, 0x99, 0x94, 0x85, 0x81, 0x7e, 0x7c, 0x71, 0x69, 0x6a, 0x68,
+  0x69, 0x64, 0x73, 0x80, 0x7c, 0x7b, 0x78, 0x78, 0x6c, 0x64, 0x68, 0x64,
+  0x67, 0x5f, 0x5f, 0x69, 0x6a, 0x70, 0x72, 0x77, 0x74, 0x6f, 0x76, 0x76,
+  0x76, 0x82, 0x8a, 0x90, 0x9c, 0x9b, 0x9c, 0x9b, 0x9d, 0x99, 0x90, 0x93,
+  0x8b, 0x89, 0x8b, 0x90, 0x9b, 0x9b, 0x9d, 0x9a, 0x99, 0x91, 0x84, 0x8a,
+  0x89, 0x84, 0x81, 0x80, 0x89, 0x85, 0x82, 0x80, 0x7d, 0x79, 0x61, 0x5e,
+  0x5f, 0x5e, 0x5f, 0x5e, 0x6a, 0x6b, 0x6b, 0x69, 0x6c, 0x77, 0x6b, 0x6a,
+  0x6f, 0x71, 0x77, 0x78, 0x86, 0x8c, 0x8e, 0x8a, 0x81, 0x86, 0x7f, 0x7d,
+  0x81, 0x81, 0x86, 0x86, 0x91, 0x97, 0x9f, 0xa7, 0xa3, 0xa6, 0x9f, 0x98,
+  0x9b, 0x98, 0x98, 0x92, 0x94, 0x90, 0x85, 0x86, 0x7f, 0x7f, 0x76, 0x6c,
+  0x6c, 0x69, 0x69, 0x67, 0x76, 0x82, 0x7c, 0x7d, 0x78, 0x79, 0x73, 0x67,
+  0x65, 0x67, 0x63, 0x5f, 0x75, 0x79, 0x77, 0x7a, 0x79, 0x7a, 0x7a, 0x7b,
+  0x7b, 0x7c, 0x7b, 0x7d, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7e, 0x82,
+  0x7a, 0x08, 0x81, 0x2a, 0x08, 0x64, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82,
+  0x83, 0x84, 0x83, 0x82, 0x83, 0x83, 0x83, 0x81, 0x82, 0x82, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x83,
+  0x82, 0x82, 0x81, 0x83, 0x82, 0x82, 0x83, 0x83, 0x81, 0x82, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81,
+  0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x82,
+  0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81,
+  0x0e, 0x08, 0x01, 0x7a, 0x7b, 0x81, 0xae, 0x08, 0x84, 0x16, 0x00, 0x81,
+  0x15, 0x00, 0x82, 0xb3, 0x08, 0x00, 0x81, 0x02, 0x81, 0x81, 0x80, 0x81,
+  0x21, 0x00, 0x81, 0xcd, 0x04, 0x74, 0x7d, 0x7d, 0x7f, 0x81, 0x83, 0x85,
+  0x87, 0x88, 0x8a, 0x8d, 0x8e, 0x8e, 0x8f, 0x92, 0x92, 0x92, 0x94, 0x94,
+  0x94, 0x95, 0x97, 0x97, 0x97, 0x97, 0x98, 0x99, 0x9a, 0x9a, 0x98, 0x95,
+  0x90, 0x8d, 0x88, 0x85, 0x82, 0x80, 0x7c, 0x79, 0x78, 0x75, 0x72, 0x70,
+  0x70, 0x6e, 0x6d, 0x6a, 0x6a, 0x69, 0x68, 0x67, 0x68, 0x67, 0x65, 0x65,
+  0x65, 0x66, 0x68, 0x6d, 0x70, 0x73, 0x77, 0x7a, 0x7c, 0x7f, 0x81, 0x83,
+  0x86, 0x87, 0x88, 0x8a, 0x8b, 0x8c, 0x8d, 0x90, 0x91, 0x91, 0x93, 0x94,
+  0x94, 0x97, 0x95, 0x98, 0x96, 0x95, 0x90, 0x8c, 0x88, 0x84, 0x82, 0x7e,
+  0x7d, 0x7a, 0x78, 0x74, 0x74, 0x70, 0x71, 0x6c, 0x6f, 0x56, 0x36, 0x3f,
+  0x3e, 0x43, 0x42, 0x49, 0x5d, 0x5e, 0x73, 0x7d, 0x79, 0x7c, 0x66, 0x69,
+  0x6d, 0x72, 0x75, 0x7f, 0x7a, 0x91, 0x82, 0x7f, 0x84, 0x83, 0x89, 0x77,
+  0x77, 0x7a, 0x7d, 0x81, 0x85, 0xad, 0xb6, 0xb2, 0xb5, 0xae, 0xb3, 0x9e,
+  0x94, 0x93, 0x8f, 0x87, 0x70, 0x7d, 0x86, 0x80, 0x80, 0x7a, 0x7d, 0x6b,
+  0x5f, 0x5f, 0x68, 0x7a, 0x71, 0x7e, 0x8e, 0x86, 0x87, 0x81, 0x84, 0x74,
+  0x62, 0x57, 0x49, 0x53, 0x51, 0x62, 0x77, 0x78, 0x7e, 0x7e, 0x84, 0x7f,
+  0x81, 0x8d, 0x8c, 0x91, 0x8f, 0x96, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x93,
+  0x7d, 0x81, 0x82, 0x87, 0x88, 0x8d, 0x9d, 0x9f, 0x97, 0x98, 0xa6, 0xa3,
+  0x88, 0x81, 0x80, 0x7c, 0x7a, 0x78, 0x88, 0x8f, 0x80, 0x6d, 0x6b, 0x6c,
+  0x59, 0x53, 0x56, 0x56, 0x56, 0x57, 0x64, 0x7c, 0x88, 0x86, 0x84, 0x89,
+  0x7a, 0x6f, 0x76, 0x77, 0x7d, 0x7e, 0x80, 0x83, 0x86, 0x88, 0x89, 0x8e,
+  0x88, 0x7b, 0x81, 0x83, 0x86, 0x93, 0xa4, 0xb1, 0xaf, 0xaf, 0xac, 0xae,
+  0x7f, 0xa7, 0x95, 0x94, 0x8e, 0x7c, 0x73, 0x78, 0x84, 0x81, 0x7e, 0x7d,
+  0x79, 0x75, 0x61, 0x64, 0x74, 0x75, 0x71, 0x72, 0x84, 0x84, 0x80, 0x7e,
+  0x7b, 0x7c, 0x5f, 0x4c, 0x4f, 0x53, 0x57, 0x5c, 0x71, 0x7a, 0x7b, 0x81,
+  0x7f, 0x8e, 0x8d, 0x84, 0x8b, 0x89, 0x8e, 0x8c, 0x9e, 0xa7, 0xa2, 0xa7,
+  0x97, 0x90, 0x88, 0x7f, 0x85, 0x85, 0x89, 0x89, 0x94, 0x9e, 0x95, 0xa1,
+  0xa2, 0x9e, 0x90, 0x7c, 0x7f, 0x79, 0x79, 0x73, 0x7d, 0x88, 0x72, 0x6d,
+  0x6c, 0x6c, 0x65, 0x53, 0x58, 0x56, 0x59, 0x56, 0x61, 0x85, 0x83, 0x81,
+  0x80, 0x83, 0x81, 0x6f, 0x75, 0x75, 0x7c, 0x77, 0x6e, 0x83, 0x86, 0x88,
+  0x8a, 0x8c, 0x8c, 0x7c, 0x7f, 0x7f, 0x8b, 0x9a, 0x99, 0xac, 0xae, 0xad,
+  0xac, 0xaa, 0xac, 0x97, 0x92, 0x83, 0x74, 0x76, 0x72, 0x7f, 0x82, 0x7d,
+  0x7c, 0x78, 0x7a, 0x6b, 0x6f, 0x79, 0x71, 0x74, 0x6e, 0x7f, 0x7c, 0x83,
+  0x7e, 0x7d, 0x7a, 0x7a, 0x5e, 0x4e, 0x54, 0x54, 0x5a, 0x5d, 0x6c, 0x7a,
+  0x7b, 0x7f, 0x83, 0x97, 0x91, 0x83, 0x8a, 0x89, 0x8d, 0x8a, 0x94, 0xa2,
+  0xa3, 0x9d, 0x8e, 0x91, 0x8f, 0x82, 0x86, 0x87, 0x8a, 0x8b, 0x90, 0x99,
+  0x9d, 0xa5, 0x9d, 0x9a, 0x93, 0x7f, 0x7c, 0x79, 0x77, 0x74, 0x76, 0x79,
+  0x6f, 0x70, 0x6d, 0x6d, 0x6a, 0x5b, 0x58, 0x5a, 0x5a, 0x5b, 0x67, 0x7e,
+  0x80, 0x7e, 0x7e, 0x7f, 0x83, 0x76, 0x72, 0x78, 0x78, 0x6f, 0x6c, 0x7f,
+  0x87, 0x87, 0x8b, 0x8b, 0x8e, 0x86, 0x7c, 0x86, 0x94, 0x99, 0x96, 0xa2,
+  0xac, 0xa9, 0xaa, 0xa9, 0xa9, 0x9f, 0x8c, 0x7d, 0x79, 0x78, 0x73, 0x79,
+  0x82, 0x7f, 0x7c, 0x79, 0x76, 0x78, 0x74, 0x73, 0x71, 0x70, 0x6d, 0x72,
+  0x80, 0x7d, 0x7b, 0x7b, 0x6d, 0x5e, 0x52, 0x51, 0x56, 0x59, 0x5f, 0x64,
+  0x78, 0x7d, 0x7e, 0x8f, 0x98, 0x95, 0x7f, 0x89, 0x87, 0x8c, 0x8c, 0x8d,
+  0x8f, 0x9d, 0xa0, 0x93, 0x91, 0x93, 0x94, 0x8a, 0x87, 0x8c, 0x8b, 0x90,
+  0x8e, 0x99, 0xa5, 0xa0, 0x9c, 0x96, 0x93, 0x85, 0x7a, 0x7b, 0x76, 0x78,
+  0x6f, 0x6a, 0x73, 0x6f, 0x6f, 0x6d, 0x6d, 0x65, 0x5a, 0x5f, 0x5a, 0x64,
+  0x6c, 0x71, 0x7d, 0x7a, 0x7c, 0x7c, 0x81, 0x7d, 0x72, 0x79, 0x71, 0x6c,
+  0x71, 0x78, 0x88, 0x89, 0x8c, 0x8c, 0x8e, 0x8d, 0x80, 0x8f, 0x95, 0x96,
+  0x96, 0x98, 0xa7, 0xa6, 0xa6, 0xa6, 0xa5, 0xa2, 0x86, 0x7c, 0x7e, 0x78,
+  0x77, 0x75, 0x80, 0x7f, 0x7d, 0x79, 0x78, 0x85, 0x77, 0x70, 0x71, 0x6e,
+  0x6f, 0x6c, 0x78, 0x7c, 0x7a, 0x74, 0x64, 0x66, 0x5a, 0x54, 0x5a, 0x5b,
+  0x63, 0x64, 0x73, 0x7c, 0x85, 0x94, 0x92, 0x96, 0x8c, 0x85, 0x8a, 0x88,
+  0x8c, 0x8a, 0x97, 0x98, 0x8d, 0x93, 0x92, 0x95, 0x8f, 0x87, 0x8a, 0x8b,
+  0x8f, 0x8c, 0x9a, 0x7f, 0xa7, 0x9f, 0x9c, 0x94, 0x93, 0x8a, 0x7a, 0x78,
+  0x76, 0x73, 0x66, 0x63, 0x73, 0x70, 0x70, 0x6c, 0x6e, 0x6a, 0x5d, 0x5b,
+  0x5d, 0x6b, 0x6c, 0x6c, 0x7a, 0x7b, 0x7c, 0x7c, 0x80, 0x80, 0x77, 0x73,
+  0x6b, 0x6d, 0x73, 0x75, 0x85, 0x8b, 0x8c, 0x8c, 0x8e, 0x8f, 0x8c, 0x92,
+  0x94, 0x94, 0x97, 0x96, 0xa2, 0xa8, 0xa6, 0xa6, 0xa6, 0x9d, 0x87, 0x7e,
+  0x7e, 0x7a, 0x79, 0x75, 0x7b, 0x81, 0x7d, 0x7a, 0x81, 0x89, 0x7c, 0x71,
+  0x71, 0x6d, 0x6e, 0x6b, 0x71, 0x7c, 0x78, 0x6b, 0x64, 0x68, 0x61, 0x57,
+  0x58, 0x5c, 0x62, 0x66, 0x6d, 0x7f, 0x8f, 0x93, 0x92, 0x95, 0x92, 0x87,
+  0x87, 0x8a, 0x8a, 0x8d, 0x8c, 0x8f, 0x91, 0x93, 0x94, 0x95, 0x96, 0x8a,
+  0x89, 0x8d, 0x8c, 0x94, 0x9b, 0xa2, 0xa1, 0x9a, 0x96, 0x91, 0x8f, 0x80,
+  0x76, 0x79, 0x6c, 0x64, 0x62, 0x6e, 0x74, 0x6f, 0x70, 0x6d, 0x6e, 0x63,
+  0x17, 0x5a, 0x68, 0x6e, 0x6c, 0x6a, 0x73, 0x7d, 0x7a, 0x7e, 0x7d, 0x82,
+  0x7d, 0x6c, 0x70, 0x73, 0x76, 0x79, 0x80, 0x8c, 0x8b, 0x8f, 0x8e, 0x92,
+  0x98, 0x82, 0x37, 0x00, 0x13, 0x9a, 0xa4, 0xa2, 0xa4, 0xa0, 0x96, 0x90,
+  0x82, 0x7f, 0x7c, 0x7a, 0x77, 0x77, 0x80, 0x7c, 0x7e, 0x86, 0x82, 0x80,
+  0x72, 0x81, 0x12, 0x01, 0x32, 0x6b, 0x77, 0x70, 0x66, 0x67, 0x66, 0x68,
+  0x5c, 0x5c, 0x60, 0x63, 0x69, 0x6b, 0x83, 0x8f, 0x8d, 0x91, 0x90, 0x93,
+  0x8a, 0x86, 0x89, 0x8a, 0x8d, 0x82, 0x89, 0x92, 0x92, 0x94, 0x93, 0x97,
+  0x90, 0x8b, 0x8e, 0x91, 0x9b, 0x99, 0x9a, 0x9e, 0x96, 0x95, 0x8e, 0x8d,
+  0x83, 0x78, 0x75, 0x67, 0x69, 0x65, 0x6a, 0x73, 0x81, 0x6d, 0x00, 0x13,
+  0x68, 0x63, 0x6d, 0x6a, 0x6b, 0x6a, 0x6b, 0x77, 0x78, 0x7b, 0x7d, 0x81,
+  0x7a, 0x6a, 0x6e, 0x71, 0x76, 0x79, 0x7c, 0x8a, 0x12, 0x8d, 0x8f, 0x8e,
+  0x99, 0xa0, 0x92, 0x92, 0x93, 0x95, 0x96, 0x96, 0xa2, 0xa4, 0xa2, 0x96,
+  0x92, 0x92, 0x83, 0x7c, 0x81, 0x0e, 0x01, 0x68, 0x79, 0x7e, 0x85, 0x85,
+  0x80, 0x81, 0x76, 0x6e, 0x6d, 0x6d, 0x6b, 0x6a, 0x6e, 0x6a, 0x67, 0x69,
+  0x66, 0x69, 0x62, 0x5c, 0x5f, 0x64, 0x69, 0x70, 0x83, 0x8e, 0x8e, 0x90,
+  0x90, 0x94, 0x90, 0x88, 0x8a, 0x8b, 0x86, 0x80, 0x87, 0x92, 0x93, 0x94,
+  0x95, 0x97, 0x95, 0x8d, 0x8d, 0x97, 0x9c, 0x98, 0x96, 0x9b, 0x99, 0x94,
+  0x91, 0x8c, 0x88, 0x7a, 0x6d, 0x69, 0x68, 0x66, 0x67, 0x71, 0x72, 0x6f,
+  0x70, 0x6e, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6a, 0x68, 0x72, 0x7a, 0x7a,
+  0x7f, 0x7c, 0x76, 0x70, 0x6d, 0x73, 0x76, 0x7a, 0x7c, 0x85, 0x8f, 0x8c,
+  0x94, 0x9e, 0x9e, 0x98, 0x90, 0x94, 0x95, 0x95, 0x96, 0x9c, 0xa5, 0x9e,
+  0x97, 0x95, 0x94, 0x8b, 0x7f, 0x16, 0x7d, 0x7a, 0x78, 0x75, 0x75, 0x86,
+  0x8a, 0x85, 0x82, 0x81, 0x7c, 0x6f, 0x6e, 0x6d, 0x6b, 0x6c, 0x62, 0x68,
+  0x78, 0x79, 0x79, 0x79, 0x7b, 0x81, 0xaa, 0x04, 0x0b, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x81, 0x1c, 0x0d,
+  0x81, 0xd0, 0x0c, 0x84, 0x00, 0x0d, 0x02, 0x81, 0x81, 0x80, 0x81, 0x58,
+  0x04, 0x81, 0x22, 0x0a, 0x81, 0x5e, 0x04, 0x81, 0x5e, 0x04, 0x00, 0x80,
+  0x84, 0x6a, 0x04, 0x82, 0x6a, 0x04, 0x81, 0x33, 0x0a, 0x81, 0x84, 0x04,
+  0x84, 0x76, 0x04, 0x02, 0x81, 0x80, 0x81, 0x81, 0x7e, 0x0c, 0x00, 0x81,
+  0x81, 0x1c, 0x0d, 0x81, 0x81, 0x04, 0x03, 0x80, 0x81, 0x81, 0x80, 0x81,
+  0x89, 0x04, 0x02, 0x80, 0x81, 0x80, 0x02, 0x80, 0x81, 0x82, 0x82, 0x56,
+  0x0d, 0x01, 0x82, 0x81, 0x81, 0x38, 0x0d, 0x83, 0x9b, 0x04, 0x6b, 0x80,
+  0x80, 0x81, 0x7d, 0x6f, 0x76, 0x73, 0x73, 0x79, 0x75, 0x7b, 0x7d, 0x77,
+  0x7b, 0x7d, 0x7b, 0x7f, 0x84, 0x79, 0x76, 0x82, 0x74, 0x78, 0x81, 0x7c,
+  0x7b, 0x7a, 0x7f, 0x86, 0x81, 0x7e, 0x84, 0x80, 0x81, 0x85, 0x81, 0x7d,
+  0x86, 0x80, 0x81, 0x87, 0x8b, 0x75, 0x84, 0x81, 0x73, 0x80, 0x79, 0x7c,
+  0x7b, 0x81, 0x85, 0x85, 0x7d, 0x87, 0x88, 0x82, 0x83, 0x7d, 0x86, 0x8c,
+  0x8a, 0x75, 0x7b, 0x7a, 0x7b, 0x84, 0x7c, 0x7f, 0x7f, 0x8c, 0x79, 0x7e,
+  0x81, 0x84, 0x8a, 0x77, 0x84, 0x84, 0x81, 0x80, 0x7e, 0x86, 0x8a, 0x7b,
+  0x85, 0x84, 0x88, 0x83, 0x7b, 0x84, 0x80, 0x86, 0x82, 0x83, 0x8d, 0x7a,
+  0x7d, 0x87, 0x7b, 0x84, 0x7f, 0x86, 0x83, 0x86, 0x81, 0x80, 0x84, 0x2d,
+  0x7d, 0x8a, 0x84, 0x81, 0x82, 0x7d, 0x82, 0x85, 0x8c, 0x7d, 0x7b, 0x7d,
+  0x7a, 0x81, 0x81, 0x84, 0x79, 0x81, 0x80, 0x83, 0x84, 0x86, 0x8a, 0x80,
+  0x75, 0x7e, 0x7e, 0x87, 0x91, 0x8a, 0x8b, 0x89, 0x89, 0x87, 0x88, 0x87,
+  0x86, 0x85, 0x85, 0x85, 0x84, 0x83, 0x84, 0x84, 0x84, 0x84, 0x81, 0x51,
+  0x05, 0x81, 0x3f, 0x05, 0x81, 0x41, 0x05, 0x81, 0xb8, 0x0d, 0x82, 0xb8,
+  0x0d, 0x82, 0x17, 0x0e, 0x03, 0x7e, 0x7f, 0x7e, 0x7f, 0x81, 0x25, 0x0e,
+  0x04, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x2d, 0x0e, 0x81, 0x10, 0x00,
+  0x0c, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e,
+  0x7f, 0x7f, 0x81, 0x21, 0x00, 0x81, 0x1b, 0x00, 0x81, 0x1e, 0x00, 0x02,
+  0x7f, 0x7f, 0x80, 0x81, 0x2e, 0x00, 0x02, 0x7f, 0x7f, 0x7f, 0x81, 0x1e,
+  0x00, 0x81, 0x2f, 0x00, 0x82, 0x33, 0x00, 0x81, 0x35, 0x00, 0x81, 0x38,
+  0x00, 0x81, 0x3b, 0x00, 0x81, 0x3e, 0x00, 0x00, 0x7f, 0x81, 0x1d, 0x0e,
+  0x01, 0x7f, 0x7d, 0x81, 0x52, 0x00, 0x00, 0x7e, 0x83, 0x3c, 0x00, 0x82,
+  0x52, 0x00, 0x82, 0x7f, 0x0e, 0x82, 0x21, 0x0e, 0x00, 0x7f, 0x82, 0x36,
+  0x0e, 0x81, 0x84, 0x0e, 0x8c, 0x8b, 0x0e, 0x84, 0x31, 0x0e, 0x00, 0x7f,
+  0x81, 0x94, 0x0e, 0x83, 0x3e, 0x0e, 0x83, 0x94, 0x0e, 0x81, 0xd0, 0x0d,
+  0x85, 0x47, 0x0e, 0x82, 0x41, 0x0e, 0x81, 0x4e, 0x0e, 0x00, 0x7f, 0x83,
+  0xad, 0x0e, 0x85, 0xa9, 0x0e, 0x85, 0x9e, 0x0e, 0x81, 0x37, 0x0d, 0x83,
+  0x7f, 0x0e, 0x01, 0x80, 0x80, 0x81, 0x85, 0x00, 0x81, 0x96, 0x00, 0x81,
+  0x99, 0x00, 0x82, 0x68, 0x0e, 0x85, 0xa4, 0x0e, 0x86, 0xd7, 0x0e, 0x81,
+  0x97, 0x0e, 0x81, 0xc2, 0x0e, 0x81, 0xc5, 0x0e, 0x81, 0x80, 0x0e, 0x84,
+  0xc0, 0x0e, 0x85, 0xf4, 0x0e, 0x82, 0x80, 0x0e, 0x00, 0x81, 0x81, 0x19,
+  0x0e, 0x82, 0xb7, 0x0e, 0x84, 0xd1, 0x0e, 0x01, 0x80, 0x80, 0x83, 0x99,
+  0x0e, 0x81, 0x28, 0x0e, 0x82, 0xa2, 0x0e, 0x81, 0x2e, 0x0e, 0x01, 0x80,
+  0x7f, 0x84, 0xf1, 0x0e, 0x81, 0xac, 0x0e, 0x00, 0x81, 0x81, 0x09, 0x0f,
+  0x84, 0xf4, 0x0e, 0x83, 0xbf, 0x0e, 0x84, 0x0e, 0x0f, 0x83, 0x0f, 0x0f,
+  0x81, 0xb6, 0x0e, 0x00, 0x81, 0x84, 0x02, 0x0f, 0x81, 0x15, 0x0c, 0x83,
+  0xc3, 0x0e, 0x85, 0x01, 0x0f, 0x82, 0xd2, 0x0e, 0x81, 0x5f, 0x0e, 0x01,
+  0x7f, 0x7f, 0x83, 0xfc, 0x0e, 0x83, 0xff, 0x0e, 0x84, 0x20, 0x0f, 0x81,
+  0xe3, 0x0e, 0x00, 0x81, 0x85, 0x2b, 0x0f, 0x81, 0xeb, 0x0e, 0x82, 0xfc,
+  0x0e, 0x00, 0x7f, 0x82, 0xfb, 0x0e, 0x81, 0xef, 0x0e, 0x85, 0x24, 0x0f,
+  0x00, 0x81, 0x81, 0xfe, 0x0e, 0x82, 0xf7, 0x0e, 0x82, 0xfe, 0x0e, 0x00,
+  0x7f, 0x81, 0x29, 0x01, 0x83, 0x06, 0x0f, 0x00, 0x7f, 0x82, 0x68, 0x0f,
+  0x83, 0x09, 0x0f, 0x81, 0x1f, 0x0f, 0x84, 0x45, 0x0f, 0x83, 0x1f, 0x0f,
+  0x83, 0x3a, 0x0f, 0x87, 0x6a, 0x0f, 0x85, 0x24, 0x0f, 0x81, 0xb4, 0x0e,
+  0x85, 0x64, 0x0f, 0x01, 0x81, 0x81, 0x86, 0x9b, 0x0f, 0x81, 0x11, 0x0f,
+  0x85, 0x5a, 0x0f, 0x86, 0x7d, 0x0f, 0x00, 0x81, 0x81, 0x41, 0x02, 0x81,
+  0x44, 0x0f, 0x00, 0x81, 0x84, 0x85, 0x0f, 0x81, 0x70, 0x0f, 0x81, 0x4e,
+  0x0f, 0x81, 0x71, 0x01, 0x81, 0x82, 0x01, 0x81, 0x5f, 0x0f, 0x81, 0x62,
+  0x0f, 0x86, 0xcc, 0x0f, 0x85, 0x57, 0x0f, 0x86, 0xd2, 0x0f, 0x82, 0x5d,
+  0x0f, 0x00, 0x81, 0x81, 0x6c, 0x02, 0x82, 0x66, 0x0f, 0x82, 0xc8, 0x0f,
+  0x87, 0xb3, 0x0f, 0x00, 0x80, 0x83, 0xb4, 0x0f, 0x81, 0x7c, 0x0f, 0x81,
+  0x7f, 0x0f, 0x85, 0xb8, 0x0f, 0x84, 0xc6, 0x0f, 0x81, 0xa2, 0x0f, 0x81,
+  0xab, 0x0f, 0x82, 0xb2, 0x0f, 0x81, 0x91, 0x0f, 0x84, 0xd1, 0x0f, 0x84,
+  0xdb, 0x0f, 0x81, 0xc8, 0x01, 0x81, 0x78, 0x0e, 0x82, 0xf2, 0x0f, 0x88,
+  0xeb, 0x0f, 0x81, 0xfd, 0x0f, 0x82, 0xb1, 0x0f, 0x81, 0x37, 0x0f, 0x84,
+  0xb0, 0x0f, 0x84, 0xef, 0x0f, 0x82, 0xb6, 0x0f, 0x00, 0x81, 0x84, 0xde,
+  0x0f, 0x81, 0xb0, 0x0f, 0x01, 0x81, 0x80, 0x81, 0x49, 0x07, 0x81, 0x13,
+  0x0d, 0x8d, 0x0f, 0x10, 0x86, 0x0b, 0x10, 0x84, 0xf0, 0x0f, 0x86, 0x1c,
+  0x10, 0x81, 0xcb, 0x0f, 0x81, 0xd8, 0x0f, 0x81, 0x0b, 0x0c, 0x81, 0x37,
+  0x10, 0x00, 0x7f, 0x81, 0x12, 0x02, 0x81, 0x3e, 0x10, 0x81, 0x3c, 0x10,
+  0x84, 0xf4, 0x0f, 0x00, 0x7f, 0x81, 0x0b, 0x10, 0x81, 0x04, 0x10, 0x83,
+  0x51, 0x10, 0x89, 0x47, 0x10, 0x81, 0x1a, 0x10, 0x84, 0x24, 0x10, 0x02,
+  0x80, 0x80, 0x80, 0x88, 0x4d, 0x10, 0x00, 0x81, 0x85, 0x2e, 0x10, 0x8f,
+  0x3b, 0x10, 0x81, 0x0a, 0x10, 0x00, 0x81, 0x84, 0x54, 0x10, 0x81, 0x1b,
+  0x03, 0x83, 0x42, 0x10, 0x81, 0x30, 0x10, 0x3f, 0x81, 0x80, 0x82, 0x7f,
+  0x81, 0x7f, 0x82, 0x7a, 0x70, 0x74, 0x76, 0x73, 0x75, 0x7a, 0x78, 0x7b,
+  0x7c, 0x7e, 0x80, 0x74, 0x75, 0x7e, 0x7e, 0x81, 0x72, 0x77, 0x7c, 0x79,
+  0x7e, 0x7b, 0x8a, 0x82, 0x76, 0x7d, 0x76, 0x85, 0x7d, 0x82, 0x7e, 0x80,
+  0x7e, 0x76, 0x7a, 0x79, 0x7d, 0x7d, 0x88, 0x80, 0x81, 0x86, 0x7f, 0x88,
+  0x90, 0x8d, 0x8b, 0x8c, 0x8e, 0x96, 0x94, 0x90, 0x93, 0x8a, 0x90, 0x94,
+  0x28, 0x9c, 0x9c, 0x8a, 0x9e, 0x9a, 0x85, 0x90, 0x8d, 0x8d, 0x86, 0x87,
+  0x8a, 0x88, 0x82, 0x7a, 0x83, 0x7b, 0x79, 0x78, 0x7e, 0x82, 0x75, 0x6d,
+  0x71, 0x6c, 0x72, 0x74, 0x71, 0x6a, 0x6b, 0x70, 0x72, 0x70, 0x68, 0x74,
+  0x71, 0x70, 0x77, 0x80, 0x75, 0x7a, 0x81, 0xa4, 0x0c, 0x52, 0x8c, 0x84,
+  0x8c, 0x8e, 0x8c, 0x8a, 0x95, 0x95, 0x8a, 0x94, 0x8b, 0x8d, 0x8d, 0x95,
+  0x95, 0x95, 0x97, 0x9b, 0x91, 0x83, 0x85, 0x7c, 0x83, 0x7c, 0x84, 0x79,
+  0x77, 0x80, 0x72, 0x75, 0x60, 0x44, 0x42, 0x3f, 0x41, 0x4a, 0x53, 0x69,
+  0x60, 0x78, 0x8b, 0x7e, 0x76, 0x61, 0x6b, 0x70, 0x7c, 0x65, 0x78, 0x94,
+  0x78, 0x7b, 0x7a, 0x79, 0x78, 0x6f, 0x70, 0x75, 0x73, 0x7d, 0x8a, 0xaf,
+  0xb1, 0xac, 0xb1, 0xb3, 0xa6, 0x96, 0x98, 0x86, 0x95, 0x8a, 0x86, 0x87,
+  0x88, 0x8f, 0x83, 0x7d, 0x83, 0x6c, 0x71, 0x66, 0x61, 0x7f, 0x7f, 0x77,
+  0x96, 0x8d, 0x8b, 0x8f, 0x86, 0x89, 0x77, 0x75, 0x63, 0x51, 0x50, 0x52,
+  0x65, 0x76, 0x73, 0x75, 0x7c, 0x85, 0x71, 0x78, 0x90, 0x80, 0x8d, 0x8a,
+  0x97, 0xad, 0xa1, 0xa5, 0xa0, 0xb0, 0x8e, 0x72, 0x7d, 0x74, 0x7c, 0x7e,
+  0x8b, 0x98, 0x9c, 0xa6, 0x9b, 0xa4, 0xa3, 0x7e, 0x88, 0x85, 0x83, 0x7e,
+  0x85, 0xa0, 0x93, 0x8a, 0x71, 0x6f, 0x7a, 0x5e, 0x52, 0x59, 0x5b, 0x5a,
+  0x66, 0x74, 0x80, 0x89, 0x88, 0x87, 0x81, 0x74, 0x6d, 0x74, 0x76, 0x73,
+  0x7c, 0x88, 0x84, 0x7a, 0x7f, 0x87, 0x8d, 0x79, 0x71, 0x83, 0x79, 0x81,
+  0x8d, 0xa0, 0xb2, 0xa9, 0xa7, 0xad, 0xa7, 0x97, 0x96, 0x8d, 0x8f, 0x87,
+  0x7d, 0x88, 0x88, 0x8b, 0x83, 0x76, 0x80, 0x75, 0x67, 0x6a, 0x72, 0x87,
+  0x76, 0x78, 0x91, 0x85, 0x85, 0x84, 0x8d, 0x76, 0x61, 0x5a, 0x49, 0x5b,
+  0x50, 0x5c, 0x6f, 0x72, 0x75, 0x80, 0x7f, 0x77, 0x7e, 0x85, 0x7c, 0x84,
+  0x84, 0x89, 0x8d, 0xa4, 0xaa, 0x9e, 0x98, 0x96, 0x7f, 0x7f, 0x7c, 0x6f,
+  0x7d, 0x7a, 0x83, 0x93, 0xa1, 0x9c, 0x9d, 0xaa, 0x9d, 0x8e, 0x87, 0x83,
+  0x85, 0x83, 0x7b, 0x96, 0x90, 0x74, 0x73, 0x6a, 0x76, 0x60, 0x61, 0x5c,
+  0x56, 0x5f, 0x5e, 0x70, 0x81, 0x8c, 0x8b, 0x86, 0x84, 0x77, 0x67, 0x73,
+  0x6f, 0x79, 0x72, 0x72, 0x86, 0x7d, 0x83, 0x87, 0x7f, 0x83, 0x79, 0x72,
+  0x76, 0x87, 0x91, 0x94, 0xa6, 0xa0, 0xa6, 0xa3, 0xa8, 0xa2, 0x8e, 0x98,
+  0x87, 0x7a, 0x81, 0x79, 0x83, 0x89, 0x80, 0x80, 0x87, 0x81, 0x6b, 0x6d,
+  0x77, 0x7f, 0x72, 0x75, 0x88, 0x83, 0x8a, 0x86, 0x7d, 0x81, 0x5c, 0x55,
+  0x5e, 0x55, 0x5f, 0x5c, 0x6c, 0x7a, 0x6f, 0x79, 0x7c, 0x8c, 0x8b, 0x78,
+  0x82, 0x85, 0x89, 0x81, 0x95, 0xa3, 0x9d, 0x9a, 0x8a, 0x86, 0x84, 0x7d,
+  0x7e, 0x83, 0x83, 0x7f, 0x82, 0x93, 0x96, 0x96, 0xa3, 0xa5, 0xa8, 0x8e,
+  0x82, 0x82, 0x7c, 0x85, 0x7e, 0x80, 0x85, 0x6b, 0x72, 0x74, 0x77, 0x74,
+  0x59, 0x63, 0x64, 0x5a, 0x5e, 0x6c, 0x81, 0x82, 0x85, 0x83, 0x7b, 0x7e,
+  0x6f, 0x6c, 0x72, 0x79, 0x6b, 0x6a, 0x86, 0x7f, 0x7b, 0x86, 0x81, 0x83,
+  0x80, 0x78, 0x78, 0x8b, 0x95, 0x98, 0xa8, 0x9a, 0x9f, 0x9e, 0x9d, 0x9c,
+  0x99, 0x8b, 0x80, 0x7e, 0x81, 0x84, 0x7e, 0x89, 0x8c, 0x7c, 0x78, 0x82,
+  0x72, 0x71, 0x77, 0x74, 0x77, 0x72, 0x78, 0x88, 0x8a, 0x85, 0x7d, 0x7a,
+  0x64, 0x51, 0x59, 0x5f, 0x5c, 0x56, 0x61, 0x71, 0x79, 0x80, 0x81, 0x8d,
+  0x8c, 0x7d, 0x87, 0x82, 0x87, 0x88, 0x96, 0x9d, 0x96, 0x98, 0x84, 0x87,
+  0x89, 0x7f, 0x7d, 0x89, 0x8d, 0x8e, 0x84, 0x91, 0x9f, 0xa3, 0xa5, 0x98,
+  0x98, 0x86, 0x85, 0x80, 0x88, 0x83, 0x6d, 0x7d, 0x70, 0x6e, 0x70, 0x70,
+  0x7f, 0x6f, 0x67, 0x68, 0x64, 0x63, 0x5e, 0x70, 0x7c, 0x85, 0x80, 0x7e,
+  0x81, 0x86, 0x71, 0x67, 0x7b, 0x66, 0x67, 0x6e, 0x70, 0x7f, 0x80, 0x86,
+  0x8a, 0x86, 0x86, 0x84, 0x82, 0x88, 0x8f, 0x8a, 0x99, 0xa4, 0xa0, 0xa0,
+  0x9c, 0xa3, 0x9e, 0x87, 0x85, 0x89, 0x7f, 0x76, 0x7d, 0x88, 0x7f, 0x87,
+  0x82, 0x79, 0x88, 0x7a, 0x79, 0x79, 0x74, 0x7b, 0x79, 0x81, 0x81, 0x85,
+  0x7e, 0x6e, 0x6f, 0x59, 0x57, 0x5e, 0x5b, 0x64, 0x63, 0x73, 0x77, 0x7a,
+  0x88, 0x8e, 0x90, 0x80, 0x83, 0x83, 0x84, 0x88, 0x80, 0x98, 0x98, 0x88,
+  0x8b, 0x87, 0x8e, 0x84, 0x88, 0x7d, 0x7c, 0x8a, 0x80, 0x97, 0xa5, 0xaf,
+  0xab, 0xa3, 0xa1, 0x93, 0x88, 0x86, 0x82, 0x81, 0x75, 0x72, 0x7e, 0x78,
+  0x79, 0x76, 0x77, 0x6e, 0x63, 0x65, 0x63, 0x70, 0x73, 0x75, 0x82, 0x7d,
+  0x7e, 0x7b, 0x7d, 0x78, 0x6d, 0x71, 0x66, 0x67, 0x6b, 0x44, 0x71, 0x81,
+  0x82, 0x86, 0x86, 0x88, 0x87, 0x7e, 0x8c, 0x8e, 0x8f, 0x90, 0x91, 0xa0,
+  0xa0, 0xa1, 0x9e, 0xa0, 0x9b, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x7a, 0x85,
+  0x84, 0x82, 0x7f, 0x84, 0x8c, 0x7c, 0x75, 0x74, 0x72, 0x73, 0x6f, 0x7b,
+  0x80, 0x7d, 0x72, 0x66, 0x6c, 0x60, 0x58, 0x5b, 0x5a, 0x5c, 0x5d, 0x6a,
+  0x77, 0x83, 0x8d, 0x8a, 0x90, 0x86, 0x7e, 0x83, 0x83, 0x86, 0x85, 0x8d,
+  0x8c, 0x88, 0x8c, 0x8b, 0x8f, 0x8a, 0x82, 0x81, 0x3a, 0x09, 0x0d, 0x9b,
+  0xa7, 0xa4, 0xa1, 0x9b, 0x99, 0x91, 0x82, 0x7e, 0x7d, 0x77, 0x69, 0x6a,
+  0x76, 0x82, 0x37, 0x00, 0x16, 0x63, 0x5f, 0x68, 0x72, 0x70, 0x6f, 0x7d,
+  0x7f, 0x7b, 0x7a, 0x7a, 0x7a, 0x73, 0x69, 0x68, 0x6c, 0x70, 0x72, 0x7e,
+  0x85, 0x86, 0x88, 0x88, 0x82, 0x1b, 0x08, 0x07, 0x90, 0x90, 0x97, 0xa0,
+  0x9d, 0x9d, 0x9d, 0x93, 0x01, 0x8d, 0x87, 0x81, 0x68, 0x00, 0x81, 0xf8,
+  0x05, 0x15, 0x89, 0x89, 0x81, 0x75, 0x75, 0x73, 0x72, 0x71, 0x73, 0x7e,
+  0x77, 0x6c, 0x6c, 0x6b, 0x68, 0x5e, 0x5e, 0x60, 0x61, 0x62, 0x65, 0x7c,
+  0x82, 0xa3, 0x0a, 0x5a, 0x81, 0x81, 0x85, 0x85, 0x88, 0x81, 0x86, 0x8d,
+  0x8c, 0x8e, 0x8e, 0x91, 0x87, 0x87, 0x89, 0x89, 0x94, 0x98, 0xa0, 0xa2,
+  0x9d, 0x9a, 0x95, 0x94, 0x86, 0x7e, 0x7e, 0x70, 0x6d, 0x6b, 0x72, 0x78,
+  0x74, 0x76, 0x72, 0x73, 0x6a, 0x65, 0x71, 0x6f, 0x70, 0x6e, 0x73, 0x7c,
+  0x78, 0x79, 0x77, 0x7c, 0x74, 0x62, 0x69, 0x6b, 0x6f, 0x71, 0x79, 0x85,
+  0x85, 0x89, 0x87, 0x91, 0x97, 0x8b, 0x8d, 0x8e, 0x90, 0x90, 0x93, 0x9e,
+  0x9d, 0x9e, 0x97, 0x90, 0x92, 0x86, 0x85, 0x83, 0x81, 0x7f, 0x7c, 0x85,
+  0x82, 0x8a, 0x8b, 0x87, 0x85, 0x77, 0x73, 0x74, 0x72, 0x72, 0x70, 0x37,
+  0x7a, 0x71, 0x6c, 0x6e, 0x6a, 0x6c, 0x61, 0x5f, 0x5f, 0x61, 0x64, 0x68,
+  0x7f, 0x89, 0x88, 0x8c, 0x8a, 0x8f, 0x85, 0x81, 0x84, 0x85, 0x85, 0x7a,
+  0x84, 0x8d, 0x8c, 0x8f, 0x8f, 0x92, 0x8c, 0x87, 0x88, 0x8e, 0x98, 0x96,
+  0x9c, 0xa3, 0x9e, 0x9b, 0x95, 0x93, 0x8a, 0x7f, 0x77, 0x6e, 0x6f, 0x6c,
+  0x6e, 0x77, 0x76, 0x77, 0x73, 0x74, 0x70, 0x6e, 0x81, 0x56, 0x0b, 0x39,
+  0x70, 0x7a, 0x7a, 0x79, 0x78, 0x79, 0x70, 0x65, 0x68, 0x6c, 0x70, 0x73,
+  0x75, 0x83, 0x88, 0x87, 0x8d, 0x97, 0x9a, 0x8e, 0x8d, 0x8f, 0x90, 0x91,
+  0x92, 0x9a, 0xa0, 0x9b, 0x92, 0x92, 0x95, 0x8b, 0x84, 0x84, 0x82, 0x7f,
+  0x7c, 0x80, 0x8a, 0x8e, 0x8b, 0x87, 0x87, 0x7d, 0x73, 0x74, 0x72, 0x71,
+  0x71, 0x6d, 0x7a, 0x7e, 0x7c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x81, 0x9d,
+  0x07, 0x00, 0x7d, 0x81, 0x80, 0x06, 0x00, 0x7f, 0x00, 0x7f, 0x81, 0x59,
+  0x0c, 0x00, 0x7f, 0x81, 0x8f, 0x06, 0x82, 0xa1, 0x06, 0x81, 0xa3, 0x06,
+  0x83, 0xdb, 0x14, 0x82, 0x71, 0x14, 0x00, 0x7f, 0x81, 0x9a, 0x14, 0x85,
+  0x7a, 0x14, 0x83, 0x7c, 0x14, 0x83, 0xdb, 0x14, 0x86, 0xfb, 0x14, 0x84,
+  0xb7, 0x14, 0x85, 0xbd, 0x14, 0x83, 0x8f, 0x14, 0x81, 0xa0, 0x14, 0x00,
+  0x81, 0x84, 0xc1, 0x14, 0x84, 0x98, 0x14, 0x81, 0x99, 0x14, 0x00, 0x81,
+  0x84, 0xe5, 0x14, 0x81, 0xda, 0x06, 0x81, 0x01, 0x15, 0x03, 0x7f, 0x7f,
+  0x7f, 0x80, 0x81, 0x0f, 0x15, 0x83, 0xc1, 0x14, 0x83, 0xe7, 0x14, 0x81,
+  0x11, 0x15, 0x84, 0xff, 0x14, 0x85, 0x33, 0x15, 0x83, 0xc6, 0x14, 0x84,
+  0x08, 0x15, 0x84, 0x0a, 0x15, 0x82, 0xf5, 0x14, 0x84, 0x11, 0x15, 0x81,
+  0xd8, 0x14, 0x83, 0xec, 0x14, 0x83, 0xd2, 0x14, 0x00, 0x7f, 0x84, 0x1f,
+  0x15, 0x81, 0xe6, 0x07, 0x86, 0x56, 0x15, 0x86, 0x5a, 0x15, 0x85, 0x5c,
+  0x15, 0x82, 0x12, 0x07, 0x01, 0x7f, 0x7f, 0x86, 0xf6, 0x14, 0x81, 0xf1,
+  0x14, 0x85, 0x00, 0x15, 0x02, 0x81, 0x80, 0x7f, 0x81, 0x8f, 0x14, 0x83,
+  0x3d, 0x15, 0x83, 0x0a, 0x15, 0x83, 0x0d, 0x15, 0x84, 0x34, 0x15, 0x83,
+  0x11, 0x15, 0x81, 0x9c, 0x0c, 0x00, 0x7f, 0x83, 0x3d, 0x15, 0x00, 0x81,
+  0x85, 0x5d, 0x15, 0x84, 0x48, 0x15, 0x86, 0x6b, 0x15, 0x00, 0x81, 0x85,
+  0x68, 0x15, 0x85, 0x9c, 0x15, 0x85, 0x32, 0x15, 0x81, 0x7c, 0x15, 0x03,
+  0x81, 0x80, 0x7f, 0x7f, 0x83, 0x8e, 0x15, 0x86, 0x39, 0x15, 0x81, 0x4a,
+  0x15, 0x86, 0x45, 0x15, 0x81, 0x50, 0x15, 0x85, 0x52, 0x15, 0x01, 0x81,
+  0x80, 0x81, 0xd7, 0x0c, 0x85, 0xc2, 0x15, 0x88, 0x59, 0x15, 0x00, 0x81,
+  0x81, 0x80, 0x15, 0x84, 0x9c, 0x15, 0x00, 0x80, 0x81, 0xea, 0x0c, 0x83,
+  0xa7, 0x15, 0x84, 0x95, 0x15, 0x85, 0xb1, 0x15, 0x00, 0x81, 0x81, 0x96,
+  0x15, 0x81, 0xa9, 0x11, 0x81, 0xd0, 0x15, 0x83, 0xbb, 0x15, 0x83, 0xb1,
+  0x15, 0x81, 0x90, 0x15, 0x00, 0x7e, 0x81, 0xdd, 0x15, 0x00, 0x7f, 0x83,
+  0xe3, 0x15, 0x81, 0x85, 0x15, 0x85, 0xe5, 0x15, 0x81, 0x1f, 0x15, 0x81,
+  0xe5, 0x00, 0x84, 0xdb, 0x15, 0x84, 0xda, 0x15, 0x86, 0xe1, 0x15, 0x81,
+  0xa3, 0x15, 0x81, 0x31, 0x15, 0x82, 0xce, 0x15, 0x01, 0x81, 0x80, 0x81,
+  0x35, 0x0d, 0x00, 0x81, 0x83, 0xb4, 0x15, 0x00, 0x81, 0x83, 0xec, 0x15,
+  0x83, 0xbc, 0x15, 0x83, 0xe3, 0x15, 0x83, 0xc2, 0x15, 0x81, 0xc5, 0x15,
+  0x82, 0xbe, 0x15, 0x00, 0x7f, 0x81, 0x25, 0x16, 0x81, 0xf0, 0x15, 0x82,
+  0xd5, 0x15, 0x81, 0xb2, 0x15, 0x81, 0x30, 0x16, 0x81, 0x2a, 0x01, 0x82,
+  0x36, 0x16, 0x8b, 0x2f, 0x16, 0x81, 0xc0, 0x14, 0x87, 0x2b, 0x16, 0x81,
+  0x05, 0x16, 0x83, 0xe5, 0x15, 0x86, 0x60, 0x16, 0x85, 0xff, 0x15, 0x87,
+  0xf0, 0x15, 0x81, 0x04, 0x16, 0x81, 0xfd, 0x15, 0x85, 0x24, 0x16, 0x00,
+  0x80, 0x81, 0x8b, 0x0d, 0x88, 0x07, 0x16, 0x81, 0x2f, 0x16, 0x00, 0x7f,
+  0x81, 0x2a, 0x16, 0x81, 0x14, 0x09, 0x85, 0x3d, 0x16, 0x00, 0x81, 0x81,
+  0x49, 0x08, 0x84, 0x75, 0x16, 0x81, 0x18, 0x16, 0x83, 0x1a, 0x16, 0x83,
+  0x50, 0x16, 0x86, 0x99, 0x16, 0x85, 0x9b, 0x16, 0x83, 0x70, 0x16, 0x81,
+  0x57, 0x16, 0x81, 0x50, 0x16, 0x86, 0xa7, 0x16, 0x81, 0xc7, 0x15, 0x86,
+  0x7d, 0x16, 0x87, 0xb0, 0x16, 0x00, 0x81, 0x84, 0x6b, 0x16, 0x84, 0x6d,
+  0x16, 0x85, 0xbb, 0x16, 0x01, 0x80, 0x80, 0x87, 0x7a, 0x16, 0x82, 0x57,
+  0x16, 0x81, 0x59, 0x16, 0x81, 0x7c, 0x08, 0x85, 0x57, 0x16, 0x00, 0x7f,
+  0x84, 0xbc, 0x16, 0x81, 0x42, 0x15, 0x87, 0xb1, 0x16, 0x86, 0xa8, 0x16,
+  0x81, 0x38, 0x01, 0x85, 0x71, 0x16, 0x81, 0x6e, 0x16, 0x82, 0x9d, 0x16,
+  0x00, 0x81, 0x82, 0xa2, 0x16, 0x81, 0x81, 0x16, 0x84, 0xaf, 0x16, 0x84,
+  0xd1, 0x16, 0x84, 0xc7, 0x16, 0x89, 0xcf, 0x16, 0x01, 0x80, 0x80, 0x81,
+  0x94, 0x09, 0x82, 0x94, 0x16, 0x00, 0x81, 0x83, 0xbd, 0x16, 0x84, 0x9d,
+  0x16, 0x02, 0x7f, 0x7f, 0x7e, 0x82, 0xd4, 0x08, 0x83, 0xa1, 0x16, 0x81,
+  0x02, 0x17, 0x85, 0xf3, 0x16, 0x84, 0xa7, 0x16, 0x81, 0xd8, 0x16, 0x00,
+  0x81, 0x81, 0xba, 0x09, 0x81, 0xbd, 0x09, 0x81, 0xbf, 0x16, 0x81, 0xf3,
+  0x12, 0x84, 0xeb, 0x16, 0x85, 0xfb, 0x16, 0x84, 0xca, 0x16, 0x85, 0x0b,
+  0x17, 0x85, 0x0c, 0x17, 0x81, 0xf9, 0x16, 0x81, 0xd7, 0x16, 0x00, 0x81,
+  0x81, 0xea, 0x16, 0x83, 0xd8, 0x16, 0x81, 0xfe, 0x16, 0x8b, 0x54, 0x17,
+  0x83, 0x43, 0x17, 0x00, 0x7e, 0x81, 0x46, 0x17, 0x81, 0xf8, 0x16, 0x84,
+  0x4a, 0x17, 0x85, 0x64, 0x17, 0x86, 0x68, 0x17, 0x81, 0x0c, 0x17, 0x81,
+  0x19, 0x17, 0x86, 0x05, 0x17, 0x84, 0x2d, 0x17, 0x82, 0xfe, 0x16, 0x81,
+  0x01, 0x17, 0x81, 0x99, 0x16, 0x87, 0x7f, 0x17, 0x84, 0x0a, 0x17, 0x00,
+  0x81, 0x81, 0x1a, 0x0a, 0x83, 0x1a, 0x17, 0x86, 0x19, 0x17, 0x00, 0x81,
+  0x81, 0x25, 0x0a, 0x83, 0x82, 0x17, 0x00, 0x7f, 0x85, 0x2c, 0x17, 0x01,
+  0x7f, 0x81, 0x82, 0x66, 0x13, 0x5b, 0x78, 0x74, 0x74, 0x78, 0x79, 0x77,
+  0x7f, 0x7b, 0x72, 0x76, 0x7b, 0x7b, 0x74, 0x7c, 0x7d, 0x80, 0x7c, 0x82,
+  0x88, 0x85, 0x74, 0x7a, 0x76, 0x7d, 0x81, 0x7a, 0x7c, 0x7d, 0x82, 0x7b,
+  0x84, 0x7b, 0x83, 0x7f, 0x7b, 0x7a, 0x7b, 0x76, 0x75, 0x7b, 0x81, 0x7f,
+  0x7e, 0x82, 0x81, 0x89, 0x8e, 0x89, 0x83, 0x85, 0x85, 0x8a, 0x8c, 0x98,
+  0x84, 0x8c, 0x93, 0x86, 0x90, 0x8d, 0x94, 0x92, 0x94, 0x93, 0x98, 0x93,
+  0x96, 0x98, 0x8b, 0x92, 0x89, 0x84, 0x8c, 0x86, 0x76, 0x7a, 0x77, 0x78,
+  0x7d, 0x74, 0x78, 0x73, 0x72, 0x75, 0x75, 0x74, 0x74, 0x76, 0x72, 0x6f,
+  0x6e, 0x6b, 0x7f, 0x6e, 0x6d, 0x70, 0x73, 0x7c, 0x7d, 0x7c, 0x7f, 0x7f,
+  0x7b, 0x86, 0x86, 0x80, 0x8a, 0x87, 0x91, 0x8a, 0x83, 0x8f, 0x8a, 0x8b,
+  0x91, 0x94, 0x8f, 0x93, 0x94, 0x8e, 0x92, 0x94, 0x95, 0x91, 0x87, 0x85,
+  0x87, 0x85, 0x83, 0x80, 0x86, 0x81, 0x69, 0x67, 0x68, 0x67, 0x6a, 0x57,
+  0x53, 0x54, 0x59, 0x55, 0x5f, 0x71, 0x75, 0x8a, 0x87, 0x86, 0x83, 0x84,
+  0x85, 0x87, 0x7c, 0x63, 0x5c, 0x62, 0x67, 0x69, 0x6e, 0x71, 0x88, 0x8d,
+  0x8e, 0x8c, 0x9e, 0xaa, 0xa7, 0xa2, 0x8c, 0x90, 0x8f, 0x92, 0x92, 0x93,
+  0x92, 0x8f, 0x93, 0x91, 0x8c, 0x8a, 0x87, 0x84, 0x82, 0x6e, 0x6a, 0x6c,
+  0x7d, 0x80, 0x7d, 0x7b, 0x80, 0x94, 0x8d, 0x8e, 0x88, 0x8a, 0x80, 0x6b,
+  0x5b, 0x53, 0x56, 0x56, 0x58, 0x5b, 0x5e, 0x64, 0x78, 0x86, 0x9c, 0x9a,
+  0x9c, 0x9a, 0x9d, 0x94, 0x80, 0x86, 0x83, 0x89, 0x7e, 0x73, 0x75, 0x7f,
+  0x86, 0x92, 0x91, 0x93, 0x93, 0x94, 0x95, 0x93, 0x8f, 0x98, 0x94, 0x93,
+  0x8d, 0x8d, 0x87, 0x8e, 0x9d, 0x96, 0x95, 0x7e, 0x74, 0x73, 0x74, 0x65,
+  0x5c, 0x5f, 0x5d, 0x5f, 0x5f, 0x61, 0x76, 0x90, 0x8c, 0x8c, 0x88, 0x88,
+  0x82, 0x87, 0x7a, 0x6d, 0x6f, 0x5c, 0x62, 0x69, 0x6f, 0x6f, 0x83, 0x8b,
+  0x8a, 0x8d, 0x8b, 0x93, 0xa5, 0xa1, 0x8d, 0x8f, 0x8e, 0x90, 0x8f, 0x93,
+  0x8f, 0x9c, 0xa1, 0x8f, 0x93, 0x8f, 0x8c, 0x87, 0x87, 0x76, 0x6e, 0x70,
+  0x6c, 0x78, 0x81, 0x7b, 0x7f, 0x90, 0x8d, 0x8a, 0x87, 0x86, 0x82, 0x83,
+  0x66, 0x4f, 0x59, 0x55, 0x59, 0x58, 0x5c, 0x5b, 0x71, 0x78, 0x7b, 0x90,
+  0x96, 0x93, 0x97, 0x90, 0x7f, 0x80, 0x82, 0x83, 0x86, 0x86, 0x74, 0x80,
+  0x8f, 0x8b, 0x90, 0x8e, 0x91, 0x90, 0x94, 0x82, 0x85, 0x97, 0x96, 0x94,
+  0x91, 0x8c, 0x8e, 0x9c, 0x98, 0x94, 0x92, 0x87, 0x7f, 0x73, 0x76, 0x68,
+  0x5d, 0x61, 0x60, 0x63, 0x60, 0x64, 0x60, 0x7f, 0x8e, 0x87, 0x87, 0x84,
+  0x83, 0x81, 0x7b, 0x68, 0x6c, 0x70, 0x65, 0x5f, 0x68, 0x67, 0x7a, 0x85,
+  0x85, 0x86, 0x88, 0x89, 0x8a, 0x9e, 0x8f, 0x8b, 0x8e, 0x8d, 0x8f, 0x8f,
+  0x90, 0x97, 0xa8, 0xa1, 0x93, 0x8e, 0x90, 0x8d, 0x8c, 0x7d, 0x75, 0x74,
+  0x73, 0x71, 0x75, 0x81, 0x7f, 0x8d, 0x8e, 0x89, 0x89, 0x86, 0x83, 0x82,
+  0x7a, 0x62, 0x58, 0x5a, 0x5c, 0x5b, 0x5f, 0x5d, 0x6b, 0x72, 0x73, 0x76,
+  0x83, 0x90, 0x8f, 0x8f, 0x7d, 0x7f, 0x81, 0x82, 0x84, 0x86, 0x86, 0x82,
+  0x89, 0x8a, 0x8b, 0x8c, 0x8e, 0x8e, 0x90, 0x84, 0x7f, 0x84, 0x91, 0x97,
+  0x94, 0x94, 0x91, 0x9f, 0x9a, 0x98, 0x92, 0x91, 0x89, 0x79, 0x6d, 0x63,
+  0x64, 0x63, 0x64, 0x64, 0x65, 0x64, 0x71, 0x7c, 0x89, 0x87, 0x83, 0x82,
+  0x81, 0x7c, 0x68, 0x6b, 0x6a, 0x7f, 0x70, 0x69, 0x61, 0x65, 0x71, 0x81,
+  0x7f, 0x83, 0x84, 0x86, 0x87, 0x87, 0x85, 0x8c, 0x8b, 0x8d, 0x8e, 0x8f,
+  0x8f, 0x93, 0xa5, 0xa1, 0xa3, 0x94, 0x8e, 0x90, 0x90, 0x86, 0x78, 0x79,
+  0x75, 0x76, 0x73, 0x74, 0x7f, 0x92, 0x90, 0x8e, 0x8a, 0x89, 0x85, 0x86,
+  0x7d, 0x6d, 0x6b, 0x5a, 0x5b, 0x5c, 0x5e, 0x5d, 0x67, 0x74, 0x6e, 0x73,
+  0x74, 0x7d, 0x8b, 0x8d, 0x7e, 0x7d, 0x80, 0x82, 0x83, 0x87, 0x85, 0x8d,
+  0x94, 0x87, 0x8c, 0x8a, 0x8c, 0x8c, 0x8e, 0x87, 0x81, 0x85, 0x83, 0x8f,
+  0x97, 0x96, 0x97, 0xa1, 0x9f, 0x9a, 0x97, 0x94, 0x8f, 0x8e, 0x7b, 0x67,
+  0x6b, 0x67, 0x69, 0x67, 0x6a, 0x67, 0x72, 0x78, 0x74, 0x82, 0x83, 0x80,
+  0x80, 0x7d, 0x6d, 0x6a, 0x6c, 0x6b, 0x6d, 0x6e, 0x63, 0x6a, 0x7b, 0x7a,
+  0x7f, 0x7e, 0x83, 0x82, 0x87, 0x7b, 0x7b, 0x8b, 0x8a, 0x8c, 0x8d, 0x8f,
+  0x91, 0x9f, 0x71, 0xa0, 0x9d, 0x9f, 0x99, 0x8d, 0x90, 0x8b, 0x80, 0x82,
+  0x7d, 0x7d, 0x7a, 0x7b, 0x75, 0x88, 0x94, 0x8d, 0x8c, 0x88, 0x86, 0x84,
+  0x81, 0x70, 0x6e, 0x6f, 0x64, 0x5d, 0x61, 0x5e, 0x67, 0x70, 0x6f, 0x6f,
+  0x6e, 0x71, 0x70, 0x82, 0x7b, 0x76, 0x7b, 0x7b, 0x7f, 0x80, 0x82, 0x85,
+  0x96, 0x94, 0x89, 0x85, 0x89, 0x88, 0x8d, 0x84, 0x7e, 0x81, 0x83, 0x85,
+  0x89, 0x97, 0x95, 0xa2, 0xa5, 0xa0, 0x9e, 0x98, 0x96, 0x92, 0x8e, 0x77,
+  0x6b, 0x6b, 0x6c, 0x6a, 0x6a, 0x68, 0x71, 0x78, 0x76, 0x74, 0x7c, 0x85,
+  0x80, 0x81, 0x70, 0x6c, 0x6c, 0x6d, 0x6d, 0x6c, 0x6e, 0x68, 0x72, 0x76,
+  0x79, 0x7a, 0x7d, 0x7f, 0x82, 0x7b, 0x75, 0x7a, 0x87, 0x8d, 0x8b, 0x8e,
+  0x8d, 0x9d, 0x9f, 0x9e, 0x9d, 0x9e, 0x9b, 0x8f, 0x89, 0x81, 0xbf, 0x11,
+  0x05, 0x7f, 0x7e, 0x7a, 0x81, 0x8b, 0x93, 0x81, 0xb2, 0x01, 0x0a, 0x86,
+  0x74, 0x73, 0x70, 0x72, 0x6a, 0x60, 0x60, 0x65, 0x71, 0x70, 0x81, 0x6d,
+  0x00, 0x12, 0x6f, 0x70, 0x73, 0x77, 0x79, 0x7c, 0x7e, 0x80, 0x82, 0x92,
+  0x93, 0x96, 0x8a, 0x85, 0x87, 0x87, 0x85, 0x7a, 0x7e, 0x81, 0x17, 0x07,
+  0x59, 0x91, 0xa1, 0xa5, 0xa4, 0xa2, 0xa1, 0x9b, 0x98, 0x93, 0x83, 0x7e,
+  0x70, 0x6d, 0x6d, 0x6d, 0x6b, 0x70, 0x7a, 0x77, 0x79, 0x74, 0x78, 0x83,
+  0x83, 0x74, 0x6f, 0x73, 0x71, 0x70, 0x71, 0x6e, 0x72, 0x79, 0x71, 0x75,
+  0x77, 0x7a, 0x7b, 0x7f, 0x7c, 0x74, 0x7a, 0x79, 0x83, 0x8b, 0x8d, 0x8b,
+  0x97, 0x9c, 0x9a, 0x9a, 0x9a, 0x99, 0x9a, 0x90, 0x81, 0x85, 0x84, 0x88,
+  0x86, 0x86, 0x80, 0x86, 0x8b, 0x86, 0x8f, 0x8f, 0x8b, 0x88, 0x86, 0x79,
+  0x74, 0x74, 0x73, 0x73, 0x71, 0x66, 0x66, 0x72, 0x6f, 0x71, 0x6f, 0x70,
+  0x6d, 0x70, 0x67, 0x64, 0x72, 0x74, 0x78, 0x5f, 0x7a, 0x7c, 0x7e, 0x8a,
+  0x8e, 0x8e, 0x91, 0x8b, 0x83, 0x86, 0x84, 0x7b, 0x7e, 0x80, 0x82, 0x82,
+  0x87, 0x84, 0x94, 0xa3, 0x9f, 0xa1, 0x9f, 0x9e, 0x9b, 0x98, 0x8a, 0x85,
+  0x83, 0x79, 0x72, 0x74, 0x70, 0x73, 0x7b, 0x79, 0x79, 0x76, 0x77, 0x74,
+  0x7f, 0x7a, 0x6f, 0x71, 0x6e, 0x70, 0x6e, 0x6f, 0x6e, 0x7a, 0x7a, 0x6e,
+  0x6e, 0x74, 0x74, 0x79, 0x76, 0x70, 0x73, 0x76, 0x78, 0x7d, 0x8b, 0x8a,
+  0x94, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x97, 0x9a, 0x89, 0x80, 0x84, 0x85,
+  0x86, 0x89, 0x87, 0x8a, 0x8f, 0x8c, 0x88, 0x8c, 0x92, 0x8b, 0x8b, 0x7f,
+  0x79, 0x78, 0x76, 0x76, 0x75, 0x74, 0x6c, 0x70, 0x81, 0x2e, 0x12, 0x11,
+  0x6e, 0x70, 0x6a, 0x60, 0x62, 0x6d, 0x74, 0x75, 0x79, 0x79, 0x86, 0x8c,
+  0x8c, 0x8d, 0x8e, 0x8f, 0x84, 0x82, 0x81, 0x1a, 0x01, 0x05, 0x81, 0x83,
+  0x84, 0x8a, 0x97, 0xa0, 0x13, 0xa1, 0x9e, 0xa0, 0x9d, 0x9e, 0x92, 0x8c,
+  0x88, 0x87, 0x81, 0x75, 0x74, 0x74, 0x7e, 0x7d, 0x7b, 0x79, 0x77, 0x77,
+  0x76, 0x81, 0x67, 0x02, 0x31, 0x71, 0x6f, 0x71, 0x6f, 0x7a, 0x7c, 0x7a,
+  0x72, 0x6b, 0x70, 0x71, 0x74, 0x6a, 0x70, 0x72, 0x75, 0x77, 0x7b, 0x84,
+  0x92, 0x99, 0x98, 0x98, 0x98, 0x99, 0x98, 0x99, 0x8e, 0x8b, 0x83, 0x82,
+  0x86, 0x85, 0x88, 0x8b, 0x95, 0x92, 0x90, 0x8a, 0x8c, 0x92, 0x91, 0x85,
+  0x7c, 0x7b, 0x7a, 0x79, 0x76, 0x75, 0x76, 0x81, 0xf8, 0x12, 0x81, 0x67,
+  0x0e, 0x81, 0x62, 0x1b, 0x83, 0x74, 0x1b, 0x00, 0x7f, 0x81, 0xa0, 0x0d,
+  0x00, 0x80, 0x81, 0x94, 0x0d, 0x81, 0x96, 0x0d, 0x84, 0x9b, 0x0d, 0x81,
+  0x6e, 0x13, 0x81, 0xa5, 0x0d, 0x81, 0xa5, 0x0d, 0x02, 0x7f, 0x7e, 0x7e,
+  0x84, 0xac, 0x0d, 0x81, 0xbd, 0x0d, 0x00, 0x7e, 0x81, 0xae, 0x0d, 0x81,
+  0xb7, 0x0d, 0x81, 0xf1, 0x1b, 0x81, 0xcb, 0x0d, 0x09, 0x7f, 0x7e, 0x7f,
+  0x80, 0x7e, 0x80, 0x7f, 0x7f, 0x7e, 0x80, 0x83, 0xcb, 0x0d, 0x81, 0xdc,
+  0x0d, 0x81, 0xa8, 0x1b, 0x81, 0xe2, 0x0d, 0x83, 0xb1, 0x1b, 0x81, 0xe8,
+  0x0d, 0x83, 0xb8, 0x1b, 0x00, 0x81, 0x81, 0x10, 0x07, 0x32, 0x7e, 0x7f,
+  0x7f, 0x80, 0x7d, 0x74, 0x76, 0x73, 0x7a, 0x7c, 0x84, 0x74, 0x75, 0x76,
+  0x75, 0x7b, 0x7f, 0x7e, 0x74, 0x7e, 0x7c, 0x80, 0x7f, 0x82, 0x84, 0x7b,
+  0x73, 0x7e, 0x7d, 0x7b, 0x78, 0x7f, 0x7f, 0x83, 0x81, 0x79, 0x87, 0x76,
+  0x74, 0x78, 0x76, 0x7f, 0x71, 0x73, 0x79, 0x6d, 0x74, 0x75, 0x7b, 0x7e,
+  0x7d, 0x7f, 0x82, 0x87, 0x84, 0x84, 0x86, 0x85, 0x8d, 0x8f, 0x91, 0x85,
+  0x8e, 0x8a, 0x8c, 0x93, 0x8b, 0x8f, 0x90, 0x93, 0x92, 0x99, 0x94, 0x91,
+  0x96, 0x90, 0x93, 0x8e, 0x8a, 0x89, 0x83, 0x89, 0x84, 0x78, 0x7f, 0x7f,
+  0x77, 0x76, 0x77, 0x76, 0x74, 0x7e, 0x70, 0x6f, 0x75, 0x6a, 0x6f, 0x6c,
+  0x75, 0x6f, 0x6c, 0x72, 0x76, 0x70, 0x74, 0x79, 0x7a, 0x7b, 0x7a, 0x85,
+  0x84, 0x83, 0x85, 0x84, 0x8f, 0x8f, 0x89, 0x90, 0x86, 0x8e, 0x90, 0x90,
+  0x92, 0x90, 0x95, 0x96, 0x8c, 0x8f, 0x98, 0x91, 0x96, 0x90, 0x88, 0x85,
+  0x84, 0x85, 0x80, 0x5b, 0x4b, 0x50, 0x52, 0x59, 0x5f, 0x5a, 0x6a, 0x6d,
+  0x6c, 0x88, 0x8d, 0x7b, 0x69, 0x64, 0x6f, 0x6c, 0x66, 0x6b, 0x88, 0x83,
+  0x6a, 0x73, 0x7c, 0x73, 0x5d, 0x64, 0x64, 0x75, 0x74, 0x6b, 0x8e, 0xaa,
+  0xa5, 0xac, 0xa9, 0xa5, 0x98, 0x87, 0x91, 0x91, 0x90, 0x84, 0x7f, 0x8d,
+  0x9a, 0x9b, 0x97, 0x95, 0x90, 0x82, 0x77, 0x7c, 0x77, 0x84, 0x8b, 0x93,
+  0x9b, 0x97, 0x9c, 0x86, 0x8c, 0x7d, 0x6a, 0x71, 0x5d, 0x5a, 0x59, 0x64,
+  0x78, 0x78, 0x74, 0x6e, 0x78, 0x6b, 0x59, 0x7f, 0x7e, 0x6f, 0x7c, 0x7c,
+  0x9d, 0x93, 0x9c, 0x9c, 0x99, 0x8f, 0x66, 0x6d, 0x72, 0x77, 0x76, 0x86,
+  0x96, 0x99, 0x92, 0x92, 0x9f, 0xaf, 0x9b, 0x9d, 0x98, 0x93, 0x95, 0x86,
+  0xa0, 0xa1, 0x9f, 0x8d, 0x78, 0x82, 0x74, 0x5a, 0x65, 0x5f, 0x5d, 0x61,
+  0x72, 0x7e, 0x84, 0x97, 0x8e, 0x96, 0x6f, 0x70, 0x71, 0x69, 0x72, 0x6a,
+  0x87, 0x7a, 0x6b, 0x76, 0x70, 0x80, 0x72, 0x6a, 0x72, 0x73, 0x7f, 0x77,
+  0x94, 0xa8, 0xa0, 0xa7, 0xa9, 0x9c, 0x97, 0x8d, 0x8c, 0x8d, 0x85, 0x7b,
+  0x81, 0x97, 0x93, 0x99, 0x96, 0x8c, 0x84, 0x78, 0x74, 0x76, 0x8b, 0x8a,
+  0x80, 0x91, 0x93, 0x8f, 0x8f, 0x8b, 0x87, 0x7f, 0x6d, 0x66, 0x5b, 0x5a,
+  0x5b, 0x5e, 0x73, 0x79, 0x78, 0x6b, 0x6c, 0x6b, 0x6a, 0x79, 0x77, 0x75,
+  0x77, 0x7f, 0x93, 0x97, 0x96, 0x96, 0x9d, 0x87, 0x70, 0x78, 0x70, 0x72,
+  0x79, 0x79, 0x87, 0x98, 0x98, 0x90, 0xa3, 0xaa, 0x96, 0x93, 0x98, 0x8e,
+  0x87, 0x8a, 0x91, 0x98, 0x8c, 0x83, 0x7d, 0x7e, 0x74, 0x68, 0x6e, 0x6a,
+  0x5b, 0x64, 0x65, 0x81, 0x92, 0x83, 0x87, 0x83, 0x80, 0x6a, 0x72, 0x6e,
+  0x6a, 0x6f, 0x64, 0x6d, 0x6f, 0x76, 0x7b, 0x7f, 0x7f, 0x6c, 0x6d, 0x6f,
+  0x71, 0x85, 0x99, 0x96, 0x9e, 0x9d, 0x9a, 0x99, 0x9c, 0x94, 0x7c, 0x8a,
+  0x78, 0x79, 0x7d, 0x8a, 0x98, 0x93, 0x92, 0x93, 0x96, 0x83, 0x7a, 0x86,
+  0x8a, 0x89, 0x8a, 0x8b, 0x8b, 0x84, 0x85, 0x87, 0x83, 0x76, 0x5b, 0x61,
+  0x65, 0x57, 0x5d, 0x67, 0x75, 0x75, 0x76, 0x6e, 0x76, 0x7c, 0x6f, 0x75,
+  0x7c, 0x7d, 0x80, 0x89, 0x7f, 0x95, 0x8b, 0x91, 0x89, 0x80, 0x82, 0x6e,
+  0x73, 0x7b, 0x7e, 0x74, 0x88, 0x94, 0x86, 0x9c, 0xa1, 0xa3, 0x9f, 0x96,
+  0x92, 0x8b, 0x91, 0x84, 0x88, 0x97, 0x88, 0x7f, 0x80, 0x7d, 0x84, 0x65,
+  0x61, 0x64, 0x63, 0x6a, 0x5f, 0x89, 0x8a, 0x85, 0x87, 0x86, 0x88, 0x77,
+  0x6b, 0x66, 0x70, 0x69, 0x5a, 0x69, 0x74, 0x71, 0x7f, 0x78, 0x7f, 0x77,
+  0x6f, 0x73, 0x80, 0x8c, 0x88, 0x96, 0x9c, 0x9d, 0xa5, 0x97, 0x99, 0x94,
+  0x85, 0x86, 0x7d, 0x7a, 0x79, 0x89, 0x94, 0x8c, 0x91, 0x8f, 0x90, 0x81,
+  0x7e, 0x8b, 0x83, 0x85, 0x80, 0x83, 0x86, 0x87, 0x8c, 0x84, 0x83, 0x6d,
+  0x5a, 0x61, 0x5d, 0x60, 0x65, 0x65, 0x6e, 0x71, 0x6c, 0x70, 0x83, 0x84,
+  0x79, 0x77, 0x7e, 0x84, 0x76, 0x7f, 0x90, 0x8e, 0x8a, 0x84, 0x87, 0x7e,
+  0x78, 0x75, 0x80, 0x7f, 0x7c, 0x87, 0x8f, 0x91, 0xa4, 0xa4, 0xa3, 0xa1,
+  0x95, 0x7f, 0x97, 0x8e, 0x92, 0x8b, 0x86, 0x8d, 0x86, 0x81, 0x79, 0x78,
+  0x7d, 0x75, 0x6a, 0x65, 0x68, 0x6a, 0x6f, 0x81, 0x89, 0x86, 0x81, 0x86,
+  0x83, 0x71, 0x6b, 0x6b, 0x6c, 0x62, 0x5d, 0x68, 0x6c, 0x74, 0x79, 0x7e,
+  0x76, 0x7e, 0x75, 0x6e, 0x85, 0x87, 0x88, 0x8f, 0x99, 0x9f, 0x9b, 0x95,
+  0x9b, 0x9a, 0x85, 0x7c, 0x78, 0x7e, 0x82, 0x85, 0x94, 0x93, 0x91, 0x97,
+  0x85, 0x87, 0x86, 0x7d, 0x89, 0x7a, 0x7e, 0x7b, 0x88, 0x8c, 0x8c, 0x8b,
+  0x72, 0x72, 0x60, 0x60, 0x5f, 0x60, 0x64, 0x64, 0x71, 0x72, 0x70, 0x7e,
+  0x89, 0x83, 0x7c, 0x72, 0x77, 0x78, 0x7f, 0x7c, 0x85, 0x9a, 0x89, 0x7b,
+  0x82, 0x87, 0x78, 0x75, 0x7f, 0x7a, 0x7e, 0x80, 0x8e, 0xa8, 0xaa, 0xaa,
+  0xa9, 0xa8, 0xa3, 0x96, 0x97, 0x93, 0x91, 0x8a, 0x7f, 0x88, 0x86, 0x81,
+  0x80, 0x7d, 0x7b, 0x6d, 0x6c, 0x69, 0x6e, 0x79, 0x78, 0x85, 0x81, 0x80,
+  0x0b, 0x7b, 0x7d, 0x6c, 0x6c, 0x65, 0x5a, 0x5f, 0x5f, 0x70, 0x76, 0x78,
+  0x7c, 0x7b, 0x80, 0x74, 0x7b, 0x88, 0x84, 0x89, 0x87, 0x95, 0x9a, 0x98,
+  0x9a, 0x96, 0x9b, 0x85, 0x79, 0x81, 0x7e, 0x83, 0x82, 0x8d, 0x93, 0x91,
+  0x8f, 0x8a, 0x97, 0x8f, 0x81, 0x81, 0x7d, 0x7e, 0x78, 0x80, 0x87, 0x84,
+  0x81, 0x70, 0x70, 0x6b, 0x5d, 0x60, 0x60, 0x62, 0x60, 0x67, 0x71, 0x74,
+  0x81, 0x7e, 0x7f, 0x7d, 0x71, 0x75, 0x76, 0x79, 0x7a, 0x80, 0x88, 0x7e,
+  0x82, 0x83, 0x85, 0x85, 0x79, 0x7b, 0x7d, 0x80, 0x81, 0x8b, 0xa1, 0xa1,
+  0xa1, 0xa0, 0x9f, 0x9f, 0x93, 0x8d, 0x8d, 0x89, 0x7d, 0x74, 0x80, 0x82,
+  0x7f, 0x7e, 0x7b, 0x7b, 0x6e, 0x68, 0x69, 0x74, 0x79, 0x74, 0x7e, 0x84,
+  0x81, 0x80, 0x7d, 0x7d, 0x75, 0x69, 0x61, 0x5f, 0x63, 0x63, 0x6d, 0x78,
+  0x79, 0x7c, 0x7d, 0x80, 0x80, 0x84, 0x24, 0x86, 0x86, 0x88, 0x88, 0x8e,
+  0x97, 0x97, 0x96, 0x98, 0x93, 0x88, 0x80, 0x83, 0x84, 0x87, 0x86, 0x8a,
+  0x94, 0x93, 0x90, 0x93, 0x97, 0x91, 0x84, 0x80, 0x7e, 0x7c, 0x7a, 0x79,
+  0x82, 0x83, 0x76, 0x71, 0x72, 0x71, 0x66, 0x62, 0x81, 0x1e, 0x06, 0x05,
+  0x6e, 0x7d, 0x7e, 0x7c, 0x7c, 0x7e, 0x81, 0xd1, 0x14, 0x2d, 0x7d, 0x7b,
+  0x7d, 0x82, 0x83, 0x84, 0x86, 0x88, 0x82, 0x7c, 0x82, 0x80, 0x87, 0x90,
+  0x98, 0x9f, 0x9d, 0x9e, 0x9c, 0x9d, 0x98, 0x8e, 0x8f, 0x85, 0x7c, 0x7a,
+  0x7b, 0x83, 0x80, 0x7e, 0x7c, 0x7b, 0x77, 0x6b, 0x72, 0x78, 0x76, 0x75,
+  0x75, 0x81, 0x7e, 0x7c, 0x7b, 0x7a, 0x77, 0x61, 0x81, 0xac, 0x00, 0x01,
+  0x67, 0x76, 0x81, 0x3c, 0x05, 0x02, 0x8c, 0x86, 0x83, 0x81, 0xff, 0x0e,
+  0x81, 0xbb, 0x16, 0x09, 0x8c, 0x8d, 0x84, 0x82, 0x85, 0x85, 0x88, 0x89,
+  0x92, 0x95, 0x46, 0x94, 0x9b, 0x95, 0x93, 0x87, 0x7e, 0x7f, 0x7b, 0x7c,
+  0x77, 0x80, 0x7f, 0x71, 0x74, 0x72, 0x73, 0x6b, 0x63, 0x65, 0x64, 0x66,
+  0x63, 0x71, 0x82, 0x7b, 0x7e, 0x7c, 0x7f, 0x7c, 0x73, 0x77, 0x78, 0x7d,
+  0x75, 0x75, 0x84, 0x83, 0x87, 0x86, 0x89, 0x87, 0x7e, 0x81, 0x83, 0x8f,
+  0x93, 0x93, 0xa0, 0x9f, 0x9e, 0x9d, 0x9d, 0x9c, 0x91, 0x8c, 0x80, 0x7d,
+  0x7b, 0x78, 0x83, 0x82, 0x7f, 0x7d, 0x7c, 0x79, 0x71, 0x77, 0x79, 0x75,
+  0x76, 0x72, 0x81, 0xd6, 0x07, 0x27, 0x7a, 0x75, 0x60, 0x5e, 0x5f, 0x60,
+  0x64, 0x66, 0x73, 0x7b, 0x7d, 0x7f, 0x87, 0x91, 0x88, 0x84, 0x87, 0x87,
+  0x89, 0x87, 0x90, 0x99, 0x99, 0x90, 0x8a, 0x8f, 0x89, 0x83, 0x86, 0x86,
+  0x88, 0x8a, 0x8e, 0x95, 0x9c, 0x9c, 0x95, 0x94, 0x8d, 0x80, 0x81, 0xf7,
+  0x16, 0x02, 0x77, 0x83, 0x86, 0x81, 0x4b, 0x12, 0x01, 0x82, 0x82, 0x03,
+  0x82, 0x83, 0x82, 0x80, 0x81, 0x8a, 0x17, 0x82, 0x60, 0x20, 0x00, 0x80,
+  0x81, 0x27, 0x12, 0x01, 0x7e, 0x7e, 0x81, 0x2e, 0x12, 0x82, 0x35, 0x12,
+  0x81, 0x07, 0x18, 0x00, 0x7f, 0x81, 0x0c, 0x18, 0x81, 0x5f, 0x13, 0x81,
+  0x3f, 0x12, 0x81, 0x65, 0x13, 0x00, 0x7e, 0x82, 0x47, 0x12, 0x81, 0xd4,
+  0x0b, 0x81, 0x20, 0x18, 0x02, 0x7e, 0x7e, 0x7d, 0x83, 0x54, 0x12, 0x81,
+  0x69, 0x12, 0x84, 0x5f, 0x12, 0x81, 0x60, 0x12, 0x00, 0x7e, 0x82, 0x67,
+  0x12, 0x81, 0x77, 0x12, 0x81, 0x7a, 0x12, 0x81, 0x7d, 0x12, 0x82, 0x70,
+  0x12, 0x81, 0x30, 0x1f, 0x81, 0x86, 0x12, 0x83, 0x63, 0x20, 0x02, 0x7f,
+  0x7f, 0x80, 0x81, 0xb9, 0x20, 0x81, 0xbc, 0x20, 0x81, 0x96, 0x12, 0x81,
+  0x99, 0x12, 0x83, 0x68, 0x20, 0x82, 0xc8, 0x20, 0x84, 0xd9, 0x20, 0x02,
+  0x7f, 0x7f, 0x81, 0x81, 0x95, 0x20, 0x83, 0x79, 0x20, 0x82, 0xd5, 0x20,
+  0x00, 0x7f, 0x82, 0x96, 0x20, 0x00, 0x7f, 0x81, 0xa7, 0x20, 0x82, 0x96,
+  0x20, 0x87, 0xcb, 0x20, 0x81, 0xae, 0x20, 0x84, 0xdb, 0x20, 0x82, 0xf1,
+  0x20, 0x85, 0x0b, 0x21, 0x84, 0x97, 0x20, 0x85, 0xc5, 0x20, 0x86, 0xec,
+  0x20, 0x01, 0x80, 0x80, 0x8d, 0xab, 0x20, 0x83, 0xaa, 0x20, 0x85, 0xd4,
+  0x20, 0x85, 0xf6, 0x20, 0x81, 0xdc, 0x20, 0x00, 0x7f, 0x81, 0x48, 0x20,
+  0x02, 0x80, 0x80, 0x7f, 0x84, 0x01, 0x21, 0x81, 0xd8, 0x20, 0x86, 0xcd,
+  0x20, 0x83, 0xf5, 0x20, 0x84, 0xc6, 0x20, 0x81, 0xd3, 0x20, 0x82, 0xfa,
+  0x20, 0x83, 0xcf, 0x20, 0x81, 0x62, 0x18, 0x84, 0xe0, 0x20, 0x00, 0x81,
+  0x84, 0x21, 0x21, 0x00, 0x80, 0x81, 0x6f, 0x18, 0x83, 0x36, 0x21, 0x82,
+  0x13, 0x21, 0x83, 0x14, 0x21, 0x85, 0x1a, 0x21, 0x86, 0x67, 0x21, 0x86,
+  0x39, 0x21, 0x87, 0x3e, 0x21, 0x84, 0x45, 0x21, 0x82, 0xfa, 0x20, 0x01,
+  0x7f, 0x81, 0x81, 0x24, 0x21, 0x01, 0x80, 0x7f, 0x81, 0x9b, 0x20, 0x81,
+  0x14, 0x21, 0x81, 0xa1, 0x20, 0x89, 0x67, 0x21, 0x01, 0x81, 0x80, 0x81,
+  0xa5, 0x18, 0x87, 0x62, 0x21, 0x85, 0x48, 0x21, 0x81, 0x1e, 0x21, 0x83,
+  0x4d, 0x21, 0x02, 0x80, 0x80, 0x7f, 0x82, 0x33, 0x21, 0x81, 0xbb, 0x18,
+  0x81, 0x38, 0x21, 0x81, 0xc6, 0x20, 0x81, 0x63, 0x21, 0x86, 0xb0, 0x21,
+  0x89, 0x7e, 0x21, 0x81, 0x48, 0x14, 0x00, 0x81, 0x86, 0x4c, 0x21, 0x83,
+  0x71, 0x21, 0x86, 0x9b, 0x21, 0x84, 0x80, 0x21, 0x83, 0x7d, 0x21, 0x82,
+  0x7f, 0x21, 0x00, 0x81, 0x81, 0x60, 0x21, 0x82, 0x59, 0x21, 0x81, 0x94,
+  0x13, 0x81, 0x6a, 0x21, 0x81, 0xf2, 0x18, 0x85, 0x9b, 0x21, 0x83, 0x71,
+  0x21, 0x02, 0x7f, 0x80, 0x80, 0x84, 0xb6, 0x21, 0x83, 0x74, 0x21, 0x00,
+  0x81, 0x84, 0xbe, 0x21, 0x86, 0xc7, 0x21, 0x84, 0xc4, 0x21, 0x86, 0xbc,
+  0x21, 0x85, 0xfb, 0x21, 0x03, 0x80, 0x81, 0x81, 0x7f, 0x86, 0x9e, 0x21,
+  0x03, 0x80, 0x81, 0x7f, 0x81, 0x82, 0xd3, 0x21, 0x83, 0xc2, 0x21, 0x85,
+  0xc8, 0x21, 0x81, 0xa7, 0x21, 0x82, 0xf1, 0x21, 0x82, 0xfe, 0x21, 0x83,
+  0xda, 0x21, 0x84, 0xe7, 0x21, 0x00, 0x80, 0x81, 0xe7, 0x1d, 0x81, 0x45,
+  0x21, 0x01, 0x80, 0x80, 0x81, 0xc1, 0x14, 0x82, 0xf8, 0x21, 0x00, 0x81,
+  0x81, 0xa4, 0x21, 0x81, 0xcc, 0x21, 0x81, 0xce, 0x21, 0x81, 0xc7, 0x21,
+  0x83, 0xf6, 0x21, 0x8b, 0xd4, 0x21, 0x85, 0x48, 0x22, 0x84, 0x00, 0x22,
+  0x86, 0x24, 0x22, 0x00, 0x7f, 0x81, 0xe6, 0x14, 0x85, 0x56, 0x22, 0x87,
+  0x32, 0x22, 0x86, 0x34, 0x22, 0x85, 0x34, 0x22, 0x81, 0x7f, 0x21, 0x84,
+  0xf2, 0x21, 0x84, 0xf0, 0x21, 0x86, 0x43, 0x22, 0x83, 0xfe, 0x21, 0x89,
+  0x69, 0x22, 0x87, 0x46, 0x22, 0x85, 0x77, 0x22, 0x86, 0x04, 0x22, 0x81,
+  0x0f, 0x22, 0x81, 0x1a, 0x22, 0x84, 0x52, 0x22, 0x88, 0x13, 0x22, 0x81,
+  0xa6, 0x21, 0x8c, 0x60, 0x22, 0x87, 0x27, 0x22, 0x82, 0x1e, 0x22, 0x86,
+  0x64, 0x22, 0x82, 0x7c, 0x22, 0x81, 0x26, 0x22, 0x86, 0x9f, 0x22, 0x82,
+  0x8c, 0x22, 0x86, 0x96, 0x22, 0x81, 0x86, 0x1f, 0x85, 0x7a, 0x22, 0x87,
+  0x91, 0x22, 0x81, 0x53, 0x22, 0x82, 0x61, 0x22, 0x00, 0x7f, 0x85, 0x87,
+  0x22, 0x86, 0x46, 0x22, 0x81, 0x2b, 0x21, 0x81, 0xab, 0x22, 0x81, 0x71,
+  0x22, 0x86, 0x9e, 0x22, 0x00, 0x81, 0x83, 0xb0, 0x22, 0x81, 0x3c, 0x21,
+  0x81, 0xcb, 0x00, 0x86, 0x66, 0x22, 0x84, 0x63, 0x22, 0x83, 0x6f, 0x22,
+  0x83, 0x70, 0x22, 0x81, 0x73, 0x22, 0x84, 0x9a, 0x22, 0x8a, 0xc0, 0x22,
+  0x84, 0xb1, 0x22, 0x83, 0x7e, 0x22, 0x81, 0x9c, 0x22, 0x8a, 0xcc, 0x22,
+  0x81, 0x88, 0x22, 0x87, 0xbe, 0x22, 0x82, 0x86, 0x22, 0x84, 0xc6, 0x22,
+  0x87, 0xd4, 0x22, 0x88, 0x93, 0x22, 0x85, 0xd0, 0x22, 0x84, 0x01, 0x23,
+  0x86, 0xc7, 0x22, 0x86, 0x12, 0x23, 0x86, 0xa5, 0x22, 0x83, 0xcd, 0x22,
+  0x03, 0x81, 0x7f, 0x7f, 0x81, 0x82, 0xcb, 0x22, 0x81, 0xb7, 0x22, 0x51,
+  0x74, 0x73, 0x74, 0x76, 0x77, 0x83, 0x7c, 0x70, 0x7a, 0x73, 0x79, 0x76,
+  0x83, 0x7a, 0x7b, 0x7d, 0x7c, 0x81, 0x80, 0x82, 0x84, 0x82, 0x7c, 0x83,
+  0x7d, 0x83, 0x7a, 0x7c, 0x82, 0x7c, 0x7e, 0x79, 0x74, 0x75, 0x6f, 0x6a,
+  0x70, 0x79, 0x81, 0x87, 0x83, 0x82, 0x8a, 0x8e, 0x99, 0xa1, 0x8b, 0x8c,
+  0x87, 0x81, 0x7f, 0x79, 0x79, 0x70, 0x75, 0x6b, 0x6e, 0x76, 0x7e, 0x81,
+  0x82, 0x8e, 0x88, 0x8c, 0x96, 0x9c, 0x97, 0x90, 0x90, 0x8d, 0x84, 0x7a,
+  0x75, 0x76, 0x74, 0x6c, 0x71, 0x72, 0x72, 0x83, 0x7b, 0x83, 0x7f, 0x8c,
+  0x88, 0x93, 0x92, 0x9b, 0x99, 0x8b, 0x89, 0x8b, 0x7b, 0x78, 0x71, 0x70,
+  0x74, 0x72, 0x75, 0x6f, 0x7d, 0x83, 0x84, 0x85, 0x8e, 0x8e, 0x94, 0x99,
+  0x98, 0x91, 0x90, 0x87, 0x7b, 0x7d, 0x78, 0x71, 0x70, 0x6b, 0x6d, 0x70,
+  0x76, 0x7f, 0x86, 0x81, 0x88, 0x8c, 0x8f, 0x91, 0x9f, 0x97, 0x7e, 0x83,
+  0x52, 0x4f, 0x45, 0x53, 0x48, 0x5b, 0x84, 0x7b, 0x86, 0x87, 0x89, 0x74,
+  0x81, 0x7b, 0x73, 0x7b, 0x94, 0x99, 0x88, 0x86, 0x84, 0x6e, 0x78, 0x7d,
+  0x6d, 0x6e, 0x80, 0x8b, 0x87, 0x93, 0x82, 0x6c, 0x5f, 0x6b, 0x70, 0x79,
+  0x8d, 0x9a, 0xa5, 0xab, 0xa5, 0x8a, 0x7c, 0x79, 0x7e, 0x77, 0x61, 0x6f,
+  0x6e, 0x6d, 0x7c, 0x76, 0x71, 0x6d, 0x8c, 0x9c, 0x9b, 0xb0, 0xb6, 0xb1,
+  0xa6, 0x96, 0x72, 0x61, 0x68, 0x5f, 0x57, 0x6c, 0x75, 0x71, 0x87, 0x9e,
+  0x93, 0x83, 0x89, 0x91, 0x90, 0xaa, 0xae, 0x7f, 0x91, 0x85, 0x88, 0x7d,
+  0x62, 0x63, 0x5d, 0x61, 0x82, 0x91, 0x8e, 0x90, 0x9b, 0x8d, 0x82, 0x86,
+  0x74, 0x79, 0x88, 0x99, 0x9b, 0x92, 0x8b, 0x77, 0x80, 0x79, 0x74, 0x73,
+  0x72, 0x81, 0x89, 0x8b, 0x7c, 0x79, 0x75, 0x6e, 0x74, 0x77, 0x7e, 0x90,
+  0xb6, 0xb4, 0x96, 0x9d, 0x7d, 0x75, 0x6e, 0x76, 0x60, 0x56, 0x6f, 0x6b,
+  0x74, 0x77, 0x7f, 0x72, 0x87, 0x90, 0x9a, 0x9e, 0xab, 0xae, 0x9f, 0xa8,
+  0x91, 0x64, 0x62, 0x5d, 0x5a, 0x5d, 0x6f, 0x73, 0x78, 0x9c, 0x9a, 0x8c,
+  0x76, 0x8d, 0x88, 0x8f, 0x9b, 0x95, 0x90, 0x86, 0x87, 0x6c, 0x6e, 0x69,
+  0x61, 0x70, 0x7d, 0x8b, 0x8a, 0x8c, 0x96, 0x87, 0x80, 0x77, 0x77, 0x78,
+  0x86, 0x99, 0x97, 0x8f, 0x84, 0x92, 0x7f, 0x77, 0x7d, 0x78, 0x6f, 0x80,
+  0x88, 0x6e, 0x76, 0x76, 0x6b, 0x6d, 0x7b, 0x7f, 0x88, 0x9e, 0xab, 0xa6,
+  0xa0, 0x90, 0x7e, 0x73, 0x7f, 0x78, 0x6a, 0x56, 0x69, 0x73, 0x70, 0x71,
+  0x7e, 0x70, 0x72, 0x98, 0x87, 0x89, 0x9e, 0xa7, 0xa9, 0x93, 0x93, 0x70,
+  0x64, 0x5f, 0x5e, 0x5f, 0x66, 0x6d, 0x73, 0x92, 0x90, 0x95, 0x84, 0x87,
+  0x8e, 0x94, 0x8e, 0x8e, 0x95, 0x8a, 0x86, 0x7d, 0x71, 0x64, 0x60, 0x72,
+  0x7a, 0x88, 0x84, 0x81, 0x8a, 0x88, 0x89, 0x70, 0x6f, 0x74, 0x77, 0x8d,
+  0x9d, 0x99, 0x81, 0x99, 0x91, 0x70, 0x7b, 0x70, 0x6d, 0x70, 0x85, 0x7d,
+  0x6f, 0x7c, 0x78, 0x74, 0x74, 0x83, 0x7e, 0x8f, 0xb3, 0xa5, 0x9a, 0x9e,
+  0x8e, 0x75, 0x78, 0x72, 0x59, 0x5e, 0x68, 0x72, 0x79, 0x78, 0x7b, 0x77,
+  0x7e, 0x8c, 0x92, 0x8c, 0x9d, 0xa4, 0xa2, 0xa3, 0x77, 0x72, 0x63, 0x62,
+  0x63, 0x5a, 0x6d, 0x6b, 0x7e, 0x8a, 0x91, 0x88, 0x7f, 0x87, 0x8d, 0x92,
+  0x8b, 0x8d, 0x96, 0x8b, 0x88, 0x7c, 0x6c, 0x65, 0x6f, 0x79, 0x74, 0x83,
+  0x86, 0x7f, 0x83, 0x86, 0x90, 0x7c, 0x6d, 0x73, 0x74, 0x7e, 0x8a, 0x98,
+  0x8e, 0x95, 0x9c, 0x8a, 0x77, 0x72, 0x73, 0x6e, 0x7b, 0x74, 0x70, 0x70,
+  0x75, 0x7a, 0x6d, 0x77, 0x7e, 0x85, 0xa0, 0xac, 0xa3, 0x94, 0x96, 0x8c,
+  0x77, 0x71, 0x61, 0x61, 0x62, 0x67, 0x6d, 0x76, 0x7a, 0x7f, 0x83, 0x7d,
+  0x8d, 0x8d, 0x8f, 0xa0, 0xaa, 0xa0, 0x8d, 0x86, 0x68, 0x65, 0x6b, 0x5b,
+  0x5c, 0x63, 0x7d, 0x88, 0x8b, 0x91, 0x8a, 0x89, 0x82, 0x86, 0x82, 0x87,
+  0x9b, 0x92, 0x8d, 0x8b, 0x81, 0x6c, 0x75, 0x83, 0x6e, 0x72, 0x7d, 0x7c,
+  0x7e, 0x8d, 0x82, 0x6b, 0x76, 0x7c, 0x81, 0x81, 0x93, 0x96, 0x90, 0x9c,
+  0x95, 0x86, 0x7a, 0x71, 0x71, 0x70, 0x74, 0x6b, 0x75, 0x6d, 0x73, 0x77,
+  0x6e, 0x7a, 0x79, 0x94, 0x9b, 0xa3, 0x9e, 0x93, 0x97, 0x8b, 0x80, 0x65,
+  0x65, 0x64, 0x5a, 0x6d, 0x6e, 0x72, 0x79, 0x88, 0x8e, 0x84, 0x7f, 0x89,
+  0x89, 0x8e, 0xa3, 0xa3, 0x8d, 0x84, 0x81, 0x78, 0x6f, 0x67, 0x62, 0x5a,
+  0x6d, 0x80, 0x81, 0x86, 0x8a, 0x89, 0x89, 0x83, 0x7d, 0x7e, 0x83, 0x96,
+  0x91, 0x8a, 0x83, 0x77, 0x70, 0x7e, 0x78, 0x70, 0x7e, 0x7b, 0x7e, 0x85,
+  0x82, 0x76, 0x75, 0x78, 0x7a, 0x7e, 0x88, 0x95, 0x95, 0x9d, 0x9e, 0x8b,
+  0x7d, 0x7a, 0x7a, 0x70, 0x71, 0x6b, 0x63, 0x71, 0x74, 0x7e, 0x74, 0x6d,
+  0x7e, 0x8a, 0x97, 0x96, 0xa6, 0xa5, 0x98, 0x9e, 0x8e, 0x76, 0x6c, 0x6c,
+  0x65, 0x6c, 0x71, 0x74, 0x78, 0x89, 0x8f, 0x85, 0x8a, 0x8e, 0x92, 0x98,
+  0xa7, 0x9d, 0x8a, 0x89, 0x7f, 0x70, 0x6b, 0x6b, 0x63, 0x69, 0x7e, 0x7f,
+  0x81, 0x87, 0x89, 0x80, 0x82, 0x84, 0x7b, 0x82, 0x8f, 0x98, 0x8e, 0x89,
+  0x85, 0x78, 0x7a, 0x77, 0x74, 0x6f, 0x73, 0x7a, 0x7c, 0x7f, 0x78, 0x74,
+  0x70, 0x75, 0x7c, 0x80, 0x8b, 0x97, 0xa1, 0x70, 0x9b, 0x95, 0x8c, 0x7a,
+  0x76, 0x73, 0x6e, 0x63, 0x66, 0x6b, 0x6e, 0x77, 0x79, 0x75, 0x73, 0x86,
+  0x8f, 0x91, 0xa1, 0xa5, 0x9c, 0x97, 0x92, 0x78, 0x64, 0x66, 0x61, 0x60,
+  0x65, 0x6d, 0x6d, 0x7b, 0x8d, 0x87, 0x81, 0x85, 0x8c, 0x8d, 0x99, 0xa0,
+  0x90, 0x89, 0x85, 0x7b, 0x6c, 0x69, 0x66, 0x63, 0x74, 0x7c, 0x7f, 0x82,
+  0x87, 0x88, 0x81, 0x7f, 0x79, 0x7d, 0x84, 0x94, 0x97, 0x8e, 0x8a, 0x84,
+  0x81, 0x7a, 0x76, 0x73, 0x6d, 0x76, 0x7b, 0x7e, 0x76, 0x76, 0x78, 0x76,
+  0x7e, 0x83, 0x87, 0x90, 0xa3, 0xa2, 0x98, 0x94, 0x87, 0x7b, 0x75, 0x74,
+  0x67, 0x61, 0x6a, 0x6d, 0x72, 0x79, 0x7c, 0x75, 0x7f, 0x8e, 0x8f, 0x96,
+  0xa1, 0xa2, 0x99, 0x96, 0x89, 0x70, 0x6a, 0x68, 0x65, 0x62, 0x6a, 0x6d,
+  0x74, 0x81, 0x5e, 0x19, 0x0a, 0x88, 0x8c, 0x90, 0x98, 0x96, 0x90, 0x89,
+  0x85, 0x79, 0x6e, 0x6b, 0x00, 0x69, 0x81, 0x91, 0x00, 0x7a, 0x7e, 0x86,
+  0x84, 0x80, 0x78, 0x7d, 0x82, 0x89, 0x96, 0x95, 0x8f, 0x88, 0x8b, 0x80,
+  0x78, 0x76, 0x70, 0x6f, 0x74, 0x7b, 0x72, 0x72, 0x7a, 0x76, 0x76, 0x7c,
+  0x82, 0x85, 0x98, 0xa7, 0x9e, 0x98, 0x91, 0x84, 0x77, 0x77, 0x6d, 0x5f,
+  0x64, 0x6a, 0x6e, 0x73, 0x7b, 0x7a, 0x7a, 0x88, 0x8c, 0x8f, 0x96, 0xa3,
+  0xa0, 0x99, 0x91, 0x7c, 0x6f, 0x6a, 0x69, 0x63, 0x63, 0x69, 0x6f, 0x7f,
+  0x85, 0x89, 0x83, 0x83, 0x89, 0x8b, 0x91, 0x92, 0x97, 0x8f, 0x89, 0x85,
+  0x77, 0x6e, 0x6b, 0x72, 0x71, 0x74, 0x7a, 0x7b, 0x80, 0x85, 0x85, 0x77,
+  0x78, 0x7f, 0x82, 0x8d, 0x98, 0x96, 0x8c, 0x91, 0x8d, 0x7d, 0x78, 0x74,
+  0x70, 0x6e, 0x77, 0x73, 0x6e, 0x77, 0x79, 0x77, 0x77, 0x80, 0x82, 0x8e,
+  0xa2, 0xa4, 0x9c, 0x96, 0x90, 0x81, 0x78, 0x73, 0x64, 0x61, 0x65, 0x6c,
+  0x6e, 0x0c, 0x75, 0x7b, 0x7b, 0x84, 0x89, 0x8e, 0x90, 0x9a, 0xa4, 0x9f,
+  0x96, 0x86, 0x7b, 0x81, 0x53, 0x00, 0x14, 0x65, 0x6c, 0x7b, 0x82, 0x86,
+  0x89, 0x83, 0x84, 0x89, 0x8d, 0x89, 0x93, 0x97, 0x8e, 0x8a, 0x82, 0x75,
+  0x6c, 0x74, 0x75, 0x6f, 0x81, 0x98, 0x1d, 0x2e, 0x88, 0x7c, 0x73, 0x7b,
+  0x80, 0x85, 0x8f, 0x9b, 0x93, 0x91, 0x95, 0x88, 0x7b, 0x76, 0x74, 0x6e,
+  0x70, 0x73, 0x6b, 0x72, 0x78, 0x7a, 0x75, 0x7a, 0x7f, 0x87, 0x97, 0xa3,
+  0xa4, 0x9b, 0x96, 0x8e, 0x7f, 0x76, 0x68, 0x64, 0x62, 0x68, 0x6d, 0x70,
+  0x78, 0x7a, 0x86, 0x88, 0x88, 0x87, 0x87, 0x81, 0x40, 0x19, 0x04, 0x84,
+  0x84, 0x84, 0x83, 0x83, 0x81, 0xc4, 0x1e, 0x85, 0xa2, 0x1e, 0x00, 0x82,
+  0x84, 0xfe, 0x26, 0x81, 0xdb, 0x26, 0x83, 0xf7, 0x26, 0x7f, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0xa7, 0x59, 0x00, 0xca, 0x7b, 0x00,
+  0x81, 0x10, 0x00, 0x82, 0x10, 0x00, 0xf8, 0x87, 0x00, 0x82, 0x17, 0x00,
+  0xc9, 0x5e, 0x00, 0xa7, 0x6e, 0x00, 0x87, 0x27, 0x00, 0xf3, 0x91, 0x00,
+  0x87, 0x2e, 0x00, 0x84, 0x2f, 0x00, 0x78, 0xb0, 0xb0, 0xb0, 0x51, 0x51,
+  0x51, 0xaf, 0xaf, 0xaf, 0x51, 0x51, 0x51, 0xaf, 0xaf, 0xaf, 0x51, 0x51,
+  0x51, 0xaf, 0xaf, 0xaf, 0x52, 0x52, 0x52, 0xae, 0xae, 0xae, 0x52, 0x52,
+  0x52, 0xae, 0xae, 0xae, 0x52, 0x52, 0x52, 0xae, 0xae, 0xae, 0x52, 0x53,
+  0x53, 0xad, 0xad, 0xad, 0x53, 0x53, 0x53, 0xad, 0xad, 0xad, 0x53, 0x53,
+  0x53, 0xad, 0xad, 0xad, 0x53, 0x53, 0x54, 0xac, 0xac, 0xac, 0x54, 0x54,
+  0x54, 0xac, 0xac, 0xac, 0x54, 0x54, 0x54, 0xac, 0xac, 0xac, 0x54, 0x54,
+  0x54, 0xab, 0xab, 0xab, 0x55, 0x55, 0x55, 0xab, 0xab, 0xab, 0xab, 0x55,
+  0x55, 0x55, 0xab, 0xab, 0xab, 0x55, 0x55, 0x56, 0xaa, 0xaa, 0xaa, 0x56,
+  0x56, 0x56, 0xaa, 0xaa, 0xaa, 0x56, 0x56, 0x56, 0xaa, 0xaa, 0xaa, 0x56,
+  0x56, 0x56, 0xa9, 0xa9, 0xa9, 0x57, 0x57, 0x57, 0x83, 0x06, 0x00, 0x83,
+  0x09, 0x00, 0x73, 0xa8, 0xa8, 0xa8, 0x58, 0x58, 0x58, 0xa8, 0xa8, 0xa8,
+  0x58, 0x58, 0x58, 0xa8, 0xa8, 0xa8, 0x58, 0x58, 0x58, 0xa8, 0xa7, 0xa7,
+  0x59, 0x59, 0x59, 0xa7, 0xa7, 0xa7, 0x59, 0x59, 0x59, 0xa7, 0xa7, 0xa7,
+  0x59, 0x59, 0x59, 0xa7, 0xa7, 0xa6, 0x5a, 0x5a, 0x5a, 0xa6, 0xa6, 0xa6,
+  0x5a, 0x5a, 0x5a, 0x5a, 0xa6, 0xa6, 0xa6, 0x5a, 0x5a, 0x5a, 0xa6, 0xa6,
+  0xa5, 0x5b, 0x5b, 0x5b, 0xa5, 0xa5, 0xa5, 0x5b, 0x5b, 0x5b, 0xa5, 0xa5,
+  0xa5, 0x5b, 0x5b, 0x5b, 0xa5, 0xa5, 0xa4, 0x5c, 0x5c, 0x5c, 0xa4, 0xa4,
+  0xa4, 0x5c, 0x5c, 0x5c, 0xa4, 0xa4, 0xa4, 0x5c, 0x5c, 0x5c, 0xa4, 0xa4,
+  0xa4, 0x5d, 0x5d, 0x5d, 0xa3, 0xa3, 0xa3, 0x5d, 0x5d, 0x5d, 0xa3, 0xa3,
+  0xa3, 0x5d, 0x5d, 0x5d, 0xa3, 0xa3, 0xa3, 0x5e, 0x5e, 0x5e, 0xa2, 0x01,
+  0xa2, 0xa2, 0x81, 0x07, 0x00, 0x01, 0xa2, 0xa2, 0x81, 0x0d, 0x00, 0x73,
+  0xa2, 0xa2, 0x5e, 0x5f, 0x5f, 0xa1, 0xa1, 0xa1, 0x5f, 0x5f, 0x5f, 0xa1,
+  0xa1, 0xa1, 0xa1, 0x5f, 0x5f, 0x5f, 0xa1, 0xa1, 0xa1, 0x5f, 0x60, 0x60,
+  0xa0, 0xa0, 0xa0, 0x60, 0x60, 0x60, 0xa0, 0xa0, 0xa0, 0x60, 0x60, 0x60,
+  0xa0, 0xa0, 0xa0, 0x60, 0x60, 0x61, 0x9f, 0x9f, 0x9f, 0x61, 0x61, 0x61,
+  0x9f, 0x9f, 0x9f, 0x61, 0x61, 0x61, 0x9f, 0x9f, 0x9f, 0x61, 0x61, 0x62,
+  0x9e, 0x9e, 0x9e, 0x62, 0x62, 0x62, 0x9e, 0x9e, 0x9e, 0x62, 0x62, 0x62,
+  0x9e, 0x9e, 0x9e, 0x62, 0x62, 0x62, 0x9d, 0x9d, 0x9d, 0x63, 0x63, 0x63,
+  0x9d, 0x9d, 0x9d, 0x63, 0x63, 0x63, 0x9d, 0x9d, 0x9d, 0x63, 0x63, 0x63,
+  0x9c, 0x9c, 0x9c, 0x64, 0x64, 0x64, 0x9c, 0x9c, 0x9c, 0x9c, 0x64, 0x64,
+  0x64, 0x9c, 0x9c, 0x9c, 0x64, 0x64, 0x64, 0x9b, 0x7f, 0x9b, 0x9b, 0x65,
+  0x65, 0x65, 0x9b, 0x9b, 0x9b, 0x65, 0x65, 0x65, 0x9b, 0x9b, 0x9b, 0x65,
+  0x65, 0x65, 0x9b, 0x9a, 0x9a, 0x66, 0x66, 0x66, 0x9a, 0x9a, 0x9a, 0x66,
+  0x66, 0x66, 0x9a, 0x9a, 0x9a, 0x66, 0x66, 0x66, 0x9a, 0x9a, 0x99, 0x67,
+  0x67, 0x67, 0x99, 0x99, 0x99, 0x67, 0x67, 0x67, 0x99, 0x99, 0x99, 0x67,
+  0x67, 0x67, 0x99, 0x99, 0x98, 0x68, 0x68, 0x68, 0x98, 0x98, 0x98, 0x68,
+  0x68, 0x68, 0x98, 0x98, 0x98, 0x68, 0x68, 0x68, 0x98, 0x98, 0x98, 0x69,
+  0x69, 0x69, 0x97, 0x97, 0x97, 0x69, 0x69, 0x69, 0x69, 0x97, 0x97, 0x97,
+  0x69, 0x69, 0x69, 0x97, 0x97, 0x96, 0x6a, 0x6a, 0x6a, 0x96, 0x96, 0x96,
+  0x6a, 0x6a, 0x6a, 0x96, 0x96, 0x96, 0x6a, 0x6a, 0x6a, 0x96, 0x96, 0x96,
+  0x6b, 0x6b, 0x6b, 0x95, 0x95, 0x95, 0x6b, 0x6b, 0x6b, 0x95, 0x95, 0x95,
+  0x6b, 0x6b, 0x6b, 0x95, 0x95, 0x7f, 0x95, 0x6b, 0x6c, 0x6c, 0x94, 0x94,
+  0x94, 0x6c, 0x6c, 0x6c, 0x94, 0x94, 0x94, 0x6c, 0x6c, 0x6c, 0x94, 0x94,
+  0x94, 0x6c, 0x6c, 0x6d, 0x93, 0x93, 0x93, 0x6d, 0x6d, 0x6d, 0x93, 0x93,
+  0x93, 0x6d, 0x6d, 0x6d, 0x93, 0x93, 0x93, 0x6d, 0x6d, 0x6e, 0x92, 0x92,
+  0x92, 0x6e, 0x6e, 0x6e, 0x92, 0x92, 0x92, 0x92, 0x6e, 0x6e, 0x6e, 0x92,
+  0x92, 0x92, 0x6e, 0x6e, 0x6f, 0x91, 0x91, 0x91, 0x6f, 0x6f, 0x6f, 0x91,
+  0x91, 0x91, 0x6f, 0x6f, 0x6f, 0x91, 0x91, 0x91, 0x6f, 0x6f, 0x70, 0x90,
+  0x90, 0x90, 0x70, 0x70, 0x70, 0x90, 0x90, 0x90, 0x70, 0x70, 0x70, 0x90,
+  0x90, 0x90, 0x70, 0x70, 0x70, 0x8f, 0x8f, 0x8f, 0x71, 0x71, 0x71, 0x8f,
+  0x8f, 0x8f, 0x71, 0x71, 0x71, 0x8f, 0x8f, 0x8f, 0x71, 0x71, 0x71, 0x8f,
+  0x8e, 0x8e, 0x72, 0x72, 0x72, 0x8e, 0x8e, 0x8e, 0x72, 0x72, 0x72, 0x8e,
+  0x8e, 0x8e, 0x82, 0x06, 0x00, 0x7a, 0x8d, 0x73, 0x73, 0x73, 0x8d, 0x8d,
+  0x8d, 0x8d, 0x73, 0x73, 0x73, 0x8d, 0x8d, 0x8d, 0x73, 0x73, 0x73, 0x8d,
+  0x8c, 0x8c, 0x74, 0x74, 0x74, 0x8c, 0x8c, 0x8c, 0x74, 0x74, 0x74, 0x8c,
+  0x8c, 0x8c, 0x74, 0x74, 0x74, 0x8c, 0x8c, 0x8b, 0x75, 0x75, 0x75, 0x8b,
+  0x8b, 0x8b, 0x75, 0x75, 0x75, 0x8b, 0x8b, 0x8b, 0x75, 0x75, 0x75, 0x8b,
+  0x8b, 0x8a, 0x76, 0x76, 0x76, 0x8a, 0x8a, 0x8a, 0x76, 0x76, 0x76, 0x8a,
+  0x8a, 0x8a, 0x76, 0x76, 0x76, 0x8a, 0x8a, 0x8a, 0x77, 0x77, 0x77, 0x89,
+  0x89, 0x89, 0x77, 0x77, 0x77, 0x89, 0x89, 0x89, 0x77, 0x77, 0x77, 0x89,
+  0x89, 0x89, 0x77, 0x78, 0x78, 0x88, 0x88, 0x88, 0x78, 0x78, 0x78, 0x78,
+  0x88, 0x88, 0x88, 0x78, 0x78, 0x78, 0x88, 0x88, 0x88, 0x78, 0x79, 0x79,
+  0x87, 0x87, 0x87, 0x79, 0x79, 0x79, 0x87, 0x87, 0x87, 0x83, 0x06, 0x00,
+  0x6f, 0x79, 0x7a, 0x7a, 0x86, 0x86, 0x86, 0x7a, 0x7a, 0x7a, 0x86, 0x86,
+  0x86, 0x7a, 0x7a, 0x7a, 0x86, 0x86, 0x86, 0x7a, 0x7a, 0x7b, 0x85, 0x85,
+  0x85, 0x7b, 0x7b, 0x7b, 0x85, 0x85, 0x85, 0x7b, 0x7b, 0x7b, 0x85, 0x85,
+  0x85, 0x7b, 0x7b, 0x7c, 0x84, 0x84, 0x84, 0x7c, 0x7c, 0x7c, 0x84, 0x84,
+  0x84, 0x7c, 0x7c, 0x7c, 0x84, 0x84, 0x84, 0x7c, 0x7c, 0x7c, 0x83, 0x83,
+  0x83, 0x7d, 0x7d, 0x7d, 0x83, 0x83, 0x83, 0x83, 0x7d, 0x7d, 0x7d, 0x83,
+  0x83, 0x83, 0x7d, 0x7d, 0x7d, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x82,
+  0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x82,
+  0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x81,
+  0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x84, 0x52, 0x2b, 0x02, 0x80, 0x80, 0x80
+};
+
+const uint16_t s_lz_blocks[] PROGMEM = {
+	    0,   129,   189,   249,   308,   363,   429,   484,
+	  541,   598,   671,   741,   807,   875,   928,   990,
+	 1052,  1160,  1289,  1418,  1547,  1676,  1805,  1934,
+	 2063,  2189,  2311,  2439,  2568,  2697,  2826,  2955,
+	 3084,  3212,  3341,  3450,  3575,  3694,  3774,  3850,
+	 3928,  4002,  4073,  4144,  4215,  4308,  4437,  4566,
+	 4695,  4824,  4953,  5080,  5207,  5336,  5414,  5479,
+	 5548,  5617,  5699,  5763,  5827,  5891,  5967,  6031,
+	 6146,  6275,  6404,  6533,  6662,  6790,  6919,  7048,
+	 7164,  7273,  7402,  7531,  7660,  7789,  7918,  8046,
+	 8174,  8303,  8402,  8476,  8543,  8610,  8681,  8752,
+	 8813,  8861,  8925,  8976,  9082,  9211,  9340,  9469,
+	 9598,  9727,  9856,  9985, 10101, 10230, 10242, 10248,
+	10257, 10263, 10388, 10511, 10640, 10769, 10898, 11025,
+};
+#else
 const unsigned char s_samples[] PROGMEM = {
   0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
   0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
@@ -1077,135 +2040,160 @@ const unsigned char s_samples[] PROGMEM = {
   0x86, 0x88, 0x88, 0x87, 0x87, 0x87, 0x86, 0x85, 0x85, 0x84, 0x84, 0x84,
   0x83, 0x83, 0x83, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
   0x82, 0x81, 0x82, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-  0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-  0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x81, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x7f, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x80, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x7f, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80,
-  0x7f, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x80,
-  0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x7f, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x81, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80,
-  0x81, 0x81, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f,
-  0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+  0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50,
+  0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50,
+  0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50,
+  0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50,
+  0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50,
+  0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50,
+  0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50,
+  0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50,
+  0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50,
+  0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50,
+  0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50,
+  0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50,
+  0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50,
+  0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50,
+  0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50,
+  0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x50, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0xb0, 0xb0, 0xb0, 0x51, 0x51,
+  0x51, 0xaf, 0xaf, 0xaf, 0x51, 0x51, 0x51, 0xaf, 0xaf, 0xaf, 0x51, 0x51,
+  0x51, 0xaf, 0xaf, 0xaf, 0x52, 0x52, 0x52, 0xae, 0xae, 0xae, 0x52, 0x52,
+  0x52, 0xae, 0xae, 0xae, 0x52, 0x52, 0x52, 0xae, 0xae, 0xae, 0x52, 0x53,
+  0x53, 0xad, 0xad, 0xad, 0x53, 0x53, 0x53, 0xad, 0xad, 0xad, 0x53, 0x53,
+  0x53, 0xad, 0xad, 0xad, 0x53, 0x53, 0x54, 0xac, 0xac, 0xac, 0x54, 0x54,
+  0x54, 0xac, 0xac, 0xac, 0x54, 0x54, 0x54, 0xac, 0xac, 0xac, 0x54, 0x54,
+  0x54, 0xab, 0xab, 0xab, 0x55, 0x55, 0x55, 0xab, 0xab, 0xab, 0xab, 0x55,
+  0x55, 0x55, 0xab, 0xab, 0xab, 0x55, 0x55, 0x56, 0xaa, 0xaa, 0xaa, 0x56,
+  0x56, 0x56, 0xaa, 0xaa, 0xaa, 0x56, 0x56, 0x56, 0xaa, 0xaa, 0xaa, 0x56,
+  0x56, 0x56, 0xa9, 0xa9, 0xa9, 0x57, 0x57, 0x57, 0xa9, 0xa9, 0xa9, 0x57,
+  0x57, 0x57, 0xa9, 0xa9, 0xa9, 0x57, 0x57, 0x57, 0xa8, 0xa8, 0xa8, 0x58,
+  0x58, 0x58, 0xa8, 0xa8, 0xa8, 0x58, 0x58, 0x58, 0xa8, 0xa8, 0xa8, 0x58,
+  0x58, 0x58, 0xa8, 0xa7, 0xa7, 0x59, 0x59, 0x59, 0xa7, 0xa7, 0xa7, 0x59,
+  0x59, 0x59, 0xa7, 0xa7, 0xa7, 0x59, 0x59, 0x59, 0xa7, 0xa7, 0xa6, 0x5a,
+  0x5a, 0x5a, 0xa6, 0xa6, 0xa6, 0x5a, 0x5a, 0x5a, 0x5a, 0xa6, 0xa6, 0xa6,
+  0x5a, 0x5a, 0x5a, 0xa6, 0xa6, 0xa5, 0x5b, 0x5b, 0x5b, 0xa5, 0xa5, 0xa5,
+  0x5b, 0x5b, 0x5b, 0xa5, 0xa5, 0xa5, 0x5b, 0x5b, 0x5b, 0xa5, 0xa5, 0xa4,
+  0x5c, 0x5c, 0x5c, 0xa4, 0xa4, 0xa4, 0x5c, 0x5c, 0x5c, 0xa4, 0xa4, 0xa4,
+  0x5c, 0x5c, 0x5c, 0xa4, 0xa4, 0xa4, 0x5d, 0x5d, 0x5d, 0xa3, 0xa3, 0xa3,
+  0x5d, 0x5d, 0x5d, 0xa3, 0xa3, 0xa3, 0x5d, 0x5d, 0x5d, 0xa3, 0xa3, 0xa3,
+  0x5e, 0x5e, 0x5e, 0xa2, 0xa2, 0xa2, 0x5e, 0x5e, 0x5e, 0xa2, 0xa2, 0xa2,
+  0x5e, 0x5e, 0x5e, 0xa2, 0xa2, 0xa2, 0x5e, 0x5f, 0x5f, 0xa1, 0xa1, 0xa1,
+  0x5f, 0x5f, 0x5f, 0xa1, 0xa1, 0xa1, 0xa1, 0x5f, 0x5f, 0x5f, 0xa1, 0xa1,
+  0xa1, 0x5f, 0x60, 0x60, 0xa0, 0xa0, 0xa0, 0x60, 0x60, 0x60, 0xa0, 0xa0,
+  0xa0, 0x60, 0x60, 0x60, 0xa0, 0xa0, 0xa0, 0x60, 0x60, 0x61, 0x9f, 0x9f,
+  0x9f, 0x61, 0x61, 0x61, 0x9f, 0x9f, 0x9f, 0x61, 0x61, 0x61, 0x9f, 0x9f,
+  0x9f, 0x61, 0x61, 0x62, 0x9e, 0x9e, 0x9e, 0x62, 0x62, 0x62, 0x9e, 0x9e,
+  0x9e, 0x62, 0x62, 0x62, 0x9e, 0x9e, 0x9e, 0x62, 0x62, 0x62, 0x9d, 0x9d,
+  0x9d, 0x63, 0x63, 0x63, 0x9d, 0x9d, 0x9d, 0x63, 0x63, 0x63, 0x9d, 0x9d,
+  0x9d, 0x63, 0x63, 0x63, 0x9c, 0x9c, 0x9c, 0x64, 0x64, 0x64, 0x9c, 0x9c,
+  0x9c, 0x9c, 0x64, 0x64, 0x64, 0x9c, 0x9c, 0x9c, 0x64, 0x64, 0x64, 0x9b,
+  0x9b, 0x9b, 0x65, 0x65, 0x65, 0x9b, 0x9b, 0x9b, 0x65, 0x65, 0x65, 0x9b,
+  0x9b, 0x9b, 0x65, 0x65, 0x65, 0x9b, 0x9a, 0x9a, 0x66, 0x66, 0x66, 0x9a,
+  0x9a, 0x9a, 0x66, 0x66, 0x66, 0x9a, 0x9a, 0x9a, 0x66, 0x66, 0x66, 0x9a,
+  0x9a, 0x99, 0x67, 0x67, 0x67, 0x99, 0x99, 0x99, 0x67, 0x67, 0x67, 0x99,
+  0x99, 0x99, 0x67, 0x67, 0x67, 0x99, 0x99, 0x98, 0x68, 0x68, 0x68, 0x98,
+  0x98, 0x98, 0x68, 0x68, 0x68, 0x98, 0x98, 0x98, 0x68, 0x68, 0x68, 0x98,
+  0x98, 0x98, 0x69, 0x69, 0x69, 0x97, 0x97, 0x97, 0x69, 0x69, 0x69, 0x69,
+  0x97, 0x97, 0x97, 0x69, 0x69, 0x69, 0x97, 0x97, 0x96, 0x6a, 0x6a, 0x6a,
+  0x96, 0x96, 0x96, 0x6a, 0x6a, 0x6a, 0x96, 0x96, 0x96, 0x6a, 0x6a, 0x6a,
+  0x96, 0x96, 0x96, 0x6b, 0x6b, 0x6b, 0x95, 0x95, 0x95, 0x6b, 0x6b, 0x6b,
+  0x95, 0x95, 0x95, 0x6b, 0x6b, 0x6b, 0x95, 0x95, 0x95, 0x6b, 0x6c, 0x6c,
+  0x94, 0x94, 0x94, 0x6c, 0x6c, 0x6c, 0x94, 0x94, 0x94, 0x6c, 0x6c, 0x6c,
+  0x94, 0x94, 0x94, 0x6c, 0x6c, 0x6d, 0x93, 0x93, 0x93, 0x6d, 0x6d, 0x6d,
+  0x93, 0x93, 0x93, 0x6d, 0x6d, 0x6d, 0x93, 0x93, 0x93, 0x6d, 0x6d, 0x6e,
+  0x92, 0x92, 0x92, 0x6e, 0x6e, 0x6e, 0x92, 0x92, 0x92, 0x92, 0x6e, 0x6e,
+  0x6e, 0x92, 0x92, 0x92, 0x6e, 0x6e, 0x6f, 0x91, 0x91, 0x91, 0x6f, 0x6f,
+  0x6f, 0x91, 0x91, 0x91, 0x6f, 0x6f, 0x6f, 0x91, 0x91, 0x91, 0x6f, 0x6f,
+  0x70, 0x90, 0x90, 0x90, 0x70, 0x70, 0x70, 0x90, 0x90, 0x90, 0x70, 0x70,
+  0x70, 0x90, 0x90, 0x90, 0x70, 0x70, 0x70, 0x8f, 0x8f, 0x8f, 0x71, 0x71,
+  0x71, 0x8f, 0x8f, 0x8f, 0x71, 0x71, 0x71, 0x8f, 0x8f, 0x8f, 0x71, 0x71,
+  0x71, 0x8f, 0x8e, 0x8e, 0x72, 0x72, 0x72, 0x8e, 0x8e, 0x8e, 0x72, 0x72,
+  0x72, 0x8e, 0x8e, 0x8e, 0x72, 0x72, 0x72, 0x8e, 0x8e, 0x8d, 0x73, 0x73,
+  0x73, 0x8d, 0x8d, 0x8d, 0x8d, 0x73, 0x73, 0x73, 0x8d, 0x8d, 0x8d, 0x73,
+  0x73, 0x73, 0x8d, 0x8c, 0x8c, 0x74, 0x74, 0x74, 0x8c, 0x8c, 0x8c, 0x74,
+  0x74, 0x74, 0x8c, 0x8c, 0x8c, 0x74, 0x74, 0x74, 0x8c, 0x8c, 0x8b, 0x75,
+  0x75, 0x75, 0x8b, 0x8b, 0x8b, 0x75, 0x75, 0x75, 0x8b, 0x8b, 0x8b, 0x75,
+  0x75, 0x75, 0x8b, 0x8b, 0x8a, 0x76, 0x76, 0x76, 0x8a, 0x8a, 0x8a, 0x76,
+  0x76, 0x76, 0x8a, 0x8a, 0x8a, 0x76, 0x76, 0x76, 0x8a, 0x8a, 0x8a, 0x77,
+  0x77, 0x77, 0x89, 0x89, 0x89, 0x77, 0x77, 0x77, 0x89, 0x89, 0x89, 0x77,
+  0x77, 0x77, 0x89, 0x89, 0x89, 0x77, 0x78, 0x78, 0x88, 0x88, 0x88, 0x78,
+  0x78, 0x78, 0x78, 0x88, 0x88, 0x88, 0x78, 0x78, 0x78, 0x88, 0x88, 0x88,
+  0x78, 0x79, 0x79, 0x87, 0x87, 0x87, 0x79, 0x79, 0x79, 0x87, 0x87, 0x87,
+  0x79, 0x79, 0x79, 0x87, 0x87, 0x87, 0x79, 0x7a, 0x7a, 0x86, 0x86, 0x86,
+  0x7a, 0x7a, 0x7a, 0x86, 0x86, 0x86, 0x7a, 0x7a, 0x7a, 0x86, 0x86, 0x86,
+  0x7a, 0x7a, 0x7b, 0x85, 0x85, 0x85, 0x7b, 0x7b, 0x7b, 0x85, 0x85, 0x85,
+  0x7b, 0x7b, 0x7b, 0x85, 0x85, 0x85, 0x7b, 0x7b, 0x7c, 0x84, 0x84, 0x84,
+  0x7c, 0x7c, 0x7c, 0x84, 0x84, 0x84, 0x7c, 0x7c, 0x7c, 0x84, 0x84, 0x84,
+  0x7c, 0x7c, 0x7c, 0x83, 0x83, 0x83, 0x7d, 0x7d, 0x7d, 0x83, 0x83, 0x83,
+  0x83, 0x7d, 0x7d, 0x7d, 0x83, 0x83, 0x83, 0x7d, 0x7d, 0x7d, 0x82, 0x82,
+  0x82, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x82, 0x82,
+  0x82, 0x7e, 0x7e, 0x7e, 0x82, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x81,
+  0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+#endif
+
+const uint16_t s_cues[] PROGMEM = {
+	    0,  2048,  3328,  5696,  8064, 11648, // theme
+	 5632,  8064, 11648, // phrase
+	 2048,  3328, // intro
+	12800, // coin
+};
+
+const beat_t s_beats[] PROGMEM = {
+	{     0, 0, 0x0000 }, {  2048, 0, 0x0001 }, {  2848, 0, 0x0000 }, {  3328, 0, 0x0001 },
+	{  4128, 0, 0x0000 }, {  5696, 0, 0x0001 }, {  6496, 0, 0x0000 }, {  8064, 0, 0x0020 },
+	{  8864, 0, 0x0000 }, {  9408, 0, 0x0fff }, { 10208, 0, 0x0000 }, { 11648, 0, 0x0080 },
+	{ 12448, 0, 0x0000 }, {  5632, 0, 0x0000 }, {  5696, 0, 0x0001 }, {  6496, 0, 0x0000 },
+	{  8064, 0, 0x0020 }, {  8864, 0, 0x0000 }, {  9408, 0, 0x0fff }, { 10208, 0, 0x0000 },
+	{ 11648, 0, 0x0080 }, { 12448, 0, 0x0000 }, {  2048, 0, 0x0001 }, {  2848, 0, 0x0000 },
+	{  3328, 0, 0x0fff }, {  4128, 0, 0x0000 }, { 12800, 1, 0x0fff }, { 13600, 1, 0x0000 },
+};
+
+const clip_t s_clips[CLIPS_NUM] PROGMEM = {
+	{ .offset =     0, .length = 12800, .cue =  0, .cues_num = 6, .beat =   0, .beats_num = 13, .flags = CLIP_LOOP }, // theme
+	{ .offset =  5632, .length =  7168, .cue =  6, .cues_num = 3, .beat =  13, .beats_num =  9, .flags = CLIP_LOOP }, // phrase
+	{ .offset =  2048, .length =  2816, .cue =  9, .cues_num = 2, .beat =  22, .beats_num =  4, .flags = 0 }, // intro
+	{ .offset = 12800, .length =  1536, .cue = 11, .cues_num = 1, .beat =  26, .beats_num =  2, .flags = 0 }, // coin
 };
 
 #endif //SOUNDDATA_H
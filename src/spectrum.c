@@ -0,0 +1,126 @@
+#include <math.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+#include "spectrum.h"
+
+// power of two, two blocks
+#define RING 128
+
+#if SPECTRUM_BANDS < 2 || SPECTRUM_BANDS > 16
+#error "SPECTRUM_BANDS is 2..16, a band per led column"
+#endif
+
+// bands are log spaced from 125Hz to 1.9kHz over the columns, the
+// compiler folds cos() and pow() of constants
+#define BAND_HZ(i) (125 * pow(1900.0 / 125, (double)(i) / (SPECTRUM_BANDS - 1)))
+#define Q14(x)     ((int16_t)((x) * 16384 + ((x) < 0 ? -0.5 : 0.5)))
+#define BAND(i)    ((i) < SPECTRUM_BANDS ? \
+	Q14(2 * cos(2 * M_PI * BAND_HZ(i) / SPECTRUM_RATE)) : 0)
+
+// 2cos(2 pi f / SPECTRUM_RATE), Q14, the most columns, unused are 0
+static const int16_t s_coeffs[16] PROGMEM = {
+	BAND(0),  BAND(1),  BAND(2),  BAND(3),
+	BAND(4),  BAND(5),  BAND(6),  BAND(7),
+	BAND(8),  BAND(9),  BAND(10), BAND(11),
+	BAND(12), BAND(13), BAND(14), BAND(15)
+};
+
+// written by the sample ISR only
+static int8_t s_ring[RING];
+static volatile uint8_t s_head;
+static uint8_t s_decimate;
+
+// main loop side
+static uint8_t s_tail;
+static uint8_t s_count;
+static int16_t s_s1[SPECTRUM_BANDS];
+static int16_t s_s2[SPECTRUM_BANDS];
+
+void spectrum_put(int8_t sample)
+{
+	if (++s_decimate != SPECTRUM_DECIMATE)
+		return;
+	s_decimate = 0;
+	s_ring[s_head++ & (RING - 1)] = sample;
+}
+
+static int16_t spectrum_coeff(uint8_t band)
+{
+	return pgm_read_word(&s_coeffs[band]);
+}
+
+/*
+ * s = x + c * s1 - s2, the product is the high word of c * s1 times
+ * 4, AVR has no barrel shifter. Input is halved, |s| of a block is
+ * below 64 * 64 / sin(2 pi 125 / 4000), ~21k, at worst, a full scale
+ * sine of the lowest band peaks at ~12k. c * s1 alone may be over
+ * 16 bits, it is summed modulo 2^16, s fits.
+ */
+static void spectrum_sample(int8_t x)
+{
+	uint8_t i;
+
+	x >>= 1;
+#if ISR_PROBE == 2
+	// high for a sample of all bands, sim -i measures it
+	cli();
+	PORTD |= (1 << 6);
+#endif
+	for (i = 0; i < SPECTRUM_BANDS; ++i) {
+		int16_t s1 = s_s1[i];
+		uint16_t p = (uint16_t)(((int32_t)spectrum_coeff(i) * s1) >> 16) << 2;
+
+		s_s1[i] = (uint16_t)x + p - (uint16_t)s_s2[i];
+		s_s2[i] = s1;
+	}
+#if ISR_PROBE == 2
+	PORTD &= ~(1 << 6);
+	sei();
+#endif
+}
+
+// power = s1^2 + s2^2 - c * s1 * s2, then its bits
+static void spectrum_levels(uint8_t* levels)
+{
+	uint8_t i;
+
+	for (i = 0; i < SPECTRUM_BANDS; ++i) {
+		int16_t s1 = s_s1[i], s2 = s_s2[i];
+		int32_t p = (int32_t)s1 * s1 + (int32_t)s2 * s2 -
+			(((int32_t)spectrum_coeff(i) * s1) >> 14) * s2;
+		uint8_t bits = 0;
+
+		for (; p > 0; p >>= 1)
+			++bits;
+		levels[i] = bits;
+		s_s1[i] = s_s2[i] = 0;
+	}
+}
+
+uint8_t spectrum_poll(uint8_t* levels)
+{
+	uint8_t head = s_head, fresh = 0, i;
+
+	// silent since the last poll, leds go dark
+	if (head == s_tail) {
+		for (i = 0; i < SPECTRUM_BANDS; ++i)
+			levels[i] = s_s1[i] = s_s2[i] = 0;
+		s_count = 0;
+		return 1;
+	}
+
+	// main loop was late, the ISR wrapped the ring, take the newest
+	if ((uint8_t)(head - s_tail) > RING)
+		s_tail = head - RING;
+
+	for (; s_tail != head; ++s_tail) {
+		spectrum_sample(s_ring[s_tail & (RING - 1)]);
+		if (++s_count == SPECTRUM_BLOCK) {
+			s_count = 0;
+			spectrum_levels(levels);
+			fresh = 1;
+		}
+	}
+	return fresh;
+}
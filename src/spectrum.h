@@ -0,0 +1,54 @@
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#include <avr/io.h>
+
+#include "ledmap.h"
+
+/*
+ * Spectrum of what plays, SPECTRUM=1.
+ *
+ * The sample ISR puts every SPECTRUM_DECIMATE-th mixed sample to a
+ * RAM ring, that's all it pays. spectrum_poll() takes them from the
+ * main loop through one Goertzel filter per band, in blocks of
+ * SPECTRUM_BLOCK samples, i.e. 16ms at 4kHz. Filters are Q14 fixed
+ * point, one 16x16 multiply per band and sample.
+ *
+ * Bands are log spaced from 125Hz to 1.9kHz, one per led column.
+ * Nothing filters before decimation, so music above 2kHz folds down
+ * into the bands, fine for leds.
+ *
+ * Per band and decimated sample, an unverified estimate by
+ * instruction count, sim/spectrumbench.sh was not run on it:
+ *
+ *   coefficient        ~8 cycles  (LPM 3 x 2, index)
+ *   s1, s2 loads       ~8 cycles
+ *   c * s1             ~25 cycles (__mulhisi3 call, MUL x 4)
+ *   << 2, x, - s2      ~9 cycles
+ *   s1, s2 stores      ~8 cycles
+ *   loop               ~5 cycles
+ *
+ * Levels add work once a block. A decimated sample lasts 2 x 1000
+ * cycles less two sample ISRs, the band limit at 8kHz follows from
+ * the measured figures only.
+ *
+ * sim/spectrumbench.sh measures both, ISR_PROBE=2 raises PD6 for a
+ * sample of all bands.
+ */
+
+#define SPECTRUM_DECIMATE 2
+#define SPECTRUM_RATE     (8000 / SPECTRUM_DECIMATE)
+#define SPECTRUM_BLOCK    64
+#define SPECTRUM_BANDS    LEDS_NUM
+// poll period, ms, one block, the ring holds two
+#define SPECTRUM_MS       (1000 * SPECTRUM_BLOCK / SPECTRUM_RATE)
+
+// sample ISR, mixed sample before the PWM offset
+void spectrum_put(int8_t sample);
+
+// main loop, every SPECTRUM_MS, returns 1 if levels are new: bits of
+// band power of the last block, ~22 for a full scale sine, all 0
+// when nothing was played since the previous call
+uint8_t spectrum_poll(uint8_t* levels);
+
+#endif //SPECTRUM_H
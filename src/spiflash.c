@@ -0,0 +1,71 @@
+#include "spiflash.h"
+#include "ledmap.h"
+
+#if LEDMAP_PINS_B & 0xf0
+#error "SPI pins PB4..7 are taken by leds"
+#endif
+
+#define CMD_READ     0x03
+#define CMD_JEDEC_ID 0x9f
+
+static uint8_t spi_xfer(uint8_t b)
+{
+	SPDR = b;
+	while (!(SPSR & (1 << SPIF)))
+		;
+	return SPDR;
+}
+
+static void spiflash_select()
+{
+	PORTB &= ~(1 << PB4);
+}
+
+static void spiflash_deselect()
+{
+	PORTB |= (1 << PB4);
+}
+
+static void spiflash_cmd(uint8_t cmd, uint32_t addr)
+{
+	spi_xfer(cmd);
+	spi_xfer(addr >> 16);
+	spi_xfer(addr >> 8);
+	spi_xfer(addr);
+}
+
+void spiflash_init()
+{
+	// CS high before it becomes an output, SS must be an output
+	// in master mode, otherwise low SS drops MSTR (p.137)
+	PORTB |= (1 << PB4);
+	DDRB |= (1 << DDB4) | (1 << DDB5) | (1 << DDB7);
+
+	// master, mode 0, F_CPU/2 = 4MHz (p.140)
+	SPCR = (1 << SPE) | (1 << MSTR);
+	SPSR = (1 << SPI2X);
+}
+
+// 0 or 0xffffff if there is no chip
+uint32_t spiflash_jedec_id()
+{
+	uint32_t id;
+
+	spiflash_select();
+	spi_xfer(CMD_JEDEC_ID);
+	id  = (uint32_t)spi_xfer(0) << 16;
+	id |= (uint16_t)spi_xfer(0) << 8;
+	id |= spi_xfer(0);
+	spiflash_deselect();
+
+	return id;
+}
+
+void spiflash_read(uint32_t addr, uint8_t* buf, uint8_t len)
+{
+	spiflash_select();
+	spiflash_cmd(CMD_READ, addr);
+	while (len--)
+		*buf++ = spi_xfer(0);
+	spiflash_deselect();
+}
@@ -0,0 +1,19 @@
+#ifndef SPIFLASH_H
+#define SPIFLASH_H
+
+#include <avr/io.h>
+
+/*
+ * 25-series serial flash on the hardware SPI
+ *
+ * CS   -> PB4 (SS)
+ * MOSI -> PB5
+ * MISO -> PB6
+ * SCK  -> PB7
+ */
+
+void spiflash_init();
+uint32_t spiflash_jedec_id();
+void spiflash_read(uint32_t addr, uint8_t* buf, uint8_t len);
+
+#endif //SPIFLASH_H
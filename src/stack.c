@@ -0,0 +1,33 @@
+#include "stack.h"
+
+// linker script symbols: end of .bss and initial stack pointer
+extern uint8_t _end;
+extern uint8_t __stack;
+
+// runs before the stack and r1 are set up (.init2), so it is
+// naked and touches only Z and r24/r25
+void stack_paint() __attribute__((naked, used, section(".init1")));
+void stack_paint()
+{
+	__asm__ __volatile__ (
+		"    ldi r30, lo8(_end)\n"
+		"    ldi r31, hi8(_end)\n"
+		"    ldi r24, %0\n"
+		"    ldi r25, hi8(__stack)\n"
+		"    rjmp 2f\n"
+		"1:  st Z+, r24\n"
+		"2:  cpi r30, lo8(__stack)\n"
+		"    cpc r31, r25\n"
+		"    brlo 1b\n"
+		"    breq 1b\n"
+		:: "M" (STACK_CANARY));
+}
+
+uint16_t stack_unused()
+{
+	const uint8_t* p = &_end;
+
+	while (p <= &__stack && *p == STACK_CANARY)
+		++p;
+	return p - &_end;
+}
@@ -0,0 +1,22 @@
+#ifndef STACK_H
+#define STACK_H
+
+#include <avr/io.h>
+
+/*
+ * Stack high-water mark.
+ *
+ * RAM between the end of .bss and the initial stack pointer is
+ * painted with STACK_CANARY before main(), bytes which still hold
+ * it were never touched by the stack. sim/fedorsim reports the same
+ * at the end of a run. Static worst case is checked at build time
+ * by tools/stackcheck.py.
+ */
+
+#define STACK_CANARY 0xc5
+
+// bytes past the end of .bss never touched, i.e. the stack reached
+// &_end + returned value, scans the whole gap, main loop only
+uint16_t stack_unused();
+
+#endif //STACK_H
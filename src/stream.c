@@ -0,0 +1,184 @@
+#include <string.h>
+#include <util/atomic.h>
+
+#include "sound.h"
+#include "spiflash.h"
+#include "stream.h"
+
+#define STREAM_HALF 64
+
+// requests from ISR to the main loop
+#define REQ_NONE  0
+#define REQ_CLOSE 0xff
+// REQ_NONE < request <= STREAM_TRACKS_MAX opens track (request - 1)
+
+static track_t s_tracks[STREAM_TRACKS_MAX];
+static uint8_t s_tracks_num;
+
+// ring, each half is owned either by the main loop (s_full[half] == 0)
+// or by the ISR (s_full[half] == 1), single byte flags, no locking
+static uint8_t s_buf[2 * STREAM_HALF];
+static volatile uint8_t s_full[2];
+static volatile uint8_t s_rd;
+static volatile uint8_t s_eof = 1;
+static volatile uint8_t s_primed;
+static volatile uint8_t s_req;
+
+// main loop side
+static uint8_t s_wr_half;
+static uint8_t s_track;
+static uint32_t s_addr;
+static uint32_t s_left;
+
+// samples which did not arrive in time
+static volatile uint16_t s_underruns;
+
+uint8_t stream_init()
+{
+	uint32_t hdr[2], id;
+
+	spiflash_init();
+
+	// no chip, MISO floats high or is held low
+	id = spiflash_jedec_id();
+	if (id == 0 || id == 0xffffff)
+		return 0;
+
+	spiflash_read(0, (uint8_t*)hdr, sizeof(hdr));
+	if (hdr[0] != STREAM_MAGIC)
+		return 0;
+
+	s_tracks_num = hdr[1] & 0xff;
+	if (s_tracks_num > STREAM_TRACKS_MAX)
+		s_tracks_num = STREAM_TRACKS_MAX;
+	spiflash_read(sizeof(hdr), (uint8_t*)s_tracks,
+				  s_tracks_num * sizeof(track_t));
+
+	return s_tracks_num;
+}
+
+void stream_open(uint8_t track)
+{
+	if (track >= s_tracks_num || !s_tracks[track].length)
+		return;
+	s_req = track + 1;
+	// interrupts are off, the ISR sees underruns, not the end of the
+	// previous track, till stream_poll() prefetches this one
+	s_full[0] = 0;
+	s_full[1] = 0;
+	s_primed = 0;
+	s_eof = 0;
+	s_rd = 0;
+}
+
+void stream_close()
+{
+	s_req = REQ_CLOSE;
+}
+
+static void stream_reset()
+{
+	// take both halves back first, ISR sees underruns till refill
+	s_full[0] = 0;
+	s_full[1] = 0;
+	s_primed = 0;
+	s_eof = 0;
+	s_rd = 0;
+	s_wr_half = 0;
+	s_left = 0;
+}
+
+// fill the half from the serial flash, wrap or pad with silence
+static void stream_fill(uint8_t* buf)
+{
+	const track_t* t = &s_tracks[s_track];
+	uint8_t n = STREAM_HALF;
+
+	while (n) {
+		if (!s_left) {
+			if (!(t->flags & CLIP_LOOP)) {
+				memset(buf, 0x80, n);
+				return;
+			}
+			s_addr = t->addr;
+			s_left = t->length;
+		}
+		uint8_t len = s_left < n ? s_left : n;
+		spiflash_read(s_addr, buf, len);
+		s_addr += len;
+		s_left -= len;
+		buf += len;
+		n -= len;
+	}
+}
+
+// main loop, ~1500 cycles per refilled half at 4MHz SPI
+void stream_poll()
+{
+	uint8_t req;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		req = s_req;
+		s_req = REQ_NONE;
+	}
+
+	if (req != REQ_NONE) {
+		stream_reset();
+		if (req == REQ_CLOSE) {
+			s_eof = 1;
+			return;
+		}
+		s_track = req - 1;
+		s_addr = s_tracks[s_track].addr;
+		s_left = s_tracks[s_track].length;
+	}
+
+	if (s_full[s_wr_half] || s_eof)
+		return;
+
+	// whole track is in the ring already
+	if (!s_left && !(s_tracks[s_track].flags & CLIP_LOOP)) {
+		s_eof = 1;
+		return;
+	}
+
+	stream_fill(&s_buf[s_wr_half * STREAM_HALF]);
+	s_full[s_wr_half] = 1;
+	s_wr_half ^= 1;
+	s_primed = 1;
+}
+
+uint16_t stream_underruns()
+{
+	return s_underruns;
+}
+
+uint8_t stream_read(uint8_t* sample)
+{
+	uint8_t rd = s_rd;
+	uint8_t half = rd / STREAM_HALF;
+
+	// a half of the previous track may be filled after stream_open()
+	if (s_req != REQ_NONE)
+		return stream_underrun;
+
+	if (!s_full[half]) {
+		if (s_eof)
+			return stream_eof;
+		// track (re)opening is not an underrun
+		if (s_primed)
+			++s_underruns;
+		return stream_underrun;
+	}
+
+	*sample = s_buf[rd++];
+
+	// half is consumed, give it back to the main loop
+	if (!(rd % STREAM_HALF)) {
+		s_full[half] = 0;
+		rd %= 2 * STREAM_HALF;
+	}
+	s_rd = rd;
+
+	return stream_ok;
+}
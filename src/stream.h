@@ -0,0 +1,41 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <avr/io.h>
+
+/*
+ * Sample stream from the serial flash.
+ *
+ * Serial flash starts with a track directory (tools/mkflash.py):
+ *
+ *   0x00  "FDSK"
+ *   0x04  tracks number
+ *   0x08  track_t[tracks number]
+ *
+ * Samples are prefetched by stream_poll() from the main loop into a
+ * double-buffered RAM ring, stream_read() takes them from the sample
+ * ISR. Nothing touches SPI from interrupt context.
+ */
+
+#define STREAM_MAGIC      0x4b534446 // "FDSK"
+#define STREAM_TRACKS_MAX 3
+
+typedef struct track {
+	uint32_t addr;
+	uint32_t length;
+	uint8_t  flags;    // CLIP_LOOP
+	uint8_t  reserved[3];
+} track_t;
+
+// number of tracks found on the serial flash
+uint8_t stream_init();
+void stream_poll();
+
+// safe to call from ISR
+void stream_open(uint8_t track);
+void stream_close();
+uint8_t stream_read(uint8_t* sample);
+
+uint16_t stream_underruns();
+
+#endif //STREAM_H
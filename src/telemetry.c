@@ -0,0 +1,66 @@
+#include "telemetry.h"
+#include "uart.h"
+
+// power of 2
+#define TM_RING 16
+
+static uint8_t s_types[TM_RING];
+static uint16_t s_values[TM_RING];
+static uint8_t s_head;
+static uint8_t s_tail;
+// next byte of the record at tail
+static uint8_t s_byte;
+
+static uint16_t s_dropped;
+
+void tm_log(uint8_t type, uint16_t value)
+{
+	uint8_t head = s_head;
+	uint8_t next = (head + 1) & (TM_RING - 1);
+
+	// backpressure, drop
+	if (next == s_tail) {
+		++s_dropped;
+		return;
+	}
+	s_types[head] = type;
+	s_values[head] = value;
+	s_head = next;
+
+	uart_tx_kick();
+}
+
+uint8_t tm_next_byte(uint8_t* b)
+{
+	uint8_t tail = s_tail;
+	uint16_t v;
+
+	if (tail == s_head) {
+		if (!s_dropped)
+			return 0;
+		// report drops once there is room again
+		tm_log(tm_dropped, s_dropped);
+		s_dropped = 0;
+	}
+
+	v = s_values[tail];
+	switch (s_byte) {
+	case 0:
+		*b = 0x80 | s_types[tail];
+		break;
+	case 1:
+		*b = 0xc0 | (v & 0x3f);
+		break;
+	case 2:
+		*b = 0xc0 | ((v >> 6) & 0x3f);
+		break;
+	default:
+		*b = 0xc0 | (v >> 12);
+		s_tail = (tail + 1) & (TM_RING - 1);
+		s_byte = 0;
+		return 1;
+	}
+	++s_byte;
+
+	return 1;
+}
@@ -0,0 +1,38 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <avr/io.h>
+
+/*
+ * Telemetry over USART TX, decoded by tools/tmdecode.py
+ *
+ * Record is 4 bytes: type and 16-bit value packed so that every
+ * byte has the high bit set, i.e. never collides with XON/XOFF:
+ *
+ *   10tttttt 11vvvvvv 11vvvvvv 11vvvvvv
+ *            value[5:0] [11:6]  [15:12]
+ *
+ * Records are queued into a 16 entry ring and sent by the UDRE ISR,
+ * a full ring drops the record and counts it, nothing ever waits.
+ */
+
+enum tm_type {
+	tm_boot = 0,     // MCUCSR reset flags
+	tm_button,       // pressed button
+	tm_mode,         // new mode, i.e. button, 0 is off
+	tm_speed,        // new speed
+	tm_isr_overruns, // counters below are sent every second
+	tm_underruns,
+	tm_rx_overruns,
+	tm_stack_free,   // bytes never touched by stack
+	tm_dropped,
+	TM_TYPES_NUM
+};
+
+// interrupts must be disabled: ISR or ATOMIC_BLOCK in main loop
+void tm_log(uint8_t type, uint16_t value);
+
+// UDRE ISR, next byte to send
+uint8_t tm_next_byte(uint8_t* b);
+
+#endif //TELEMETRY_H
@@ -0,0 +1,193 @@
+#include <avr/interrupt.h>
+
+#include "sound.h"
+#include "telemetry.h"
+#include "uart.h"
+#include "ledmap.h"
+
+#if LEDMAP_PINS_D & 0x03
+#error "USART pins PD0, PD1 are taken by leds"
+#endif
+
+#if UART_STREAM && UART_UPLOAD
+#error "UART_STREAM and UART_UPLOAD both need USART RX"
+#endif
+
+#if UART_STREAM || UART_UPLOAD
+// ring indexes wrap by themselves
+#define RX_SIZE     256
+
+static uint8_t s_rx[RX_SIZE];
+static volatile uint8_t s_rx_head;
+static volatile uint8_t s_rx_tail;
+
+// statistics
+static volatile uint16_t s_rx_overruns;
+#endif
+
+#if UART_STREAM
+#define RX_PREFILL  (RX_SIZE / 2)
+#define RX_HIGH     (RX_SIZE * 3 / 4)
+#define RX_LOW      (RX_SIZE / 4)
+
+// 100ms of silence from host ends the stream
+#define STARVE_MAX  800
+
+static volatile uint8_t s_playing;
+static uint8_t s_xoff;
+static uint8_t s_last = 0x80;
+static uint16_t s_starve;
+
+// statistics
+static volatile uint16_t s_rx_underruns;
+#endif
+
+// control byte waiting for the transmitter, goes before telemetry
+static volatile uint8_t s_tx_ctrl;
+
+void uart_init()
+{
+	// double speed, UBRR = F_CPU / (8 * BAUD) - 1 (p.147)
+	UCSRA = (1 << U2X);
+	UBRRH = 0;
+	UBRRL = F_CPU / (8UL * UART_BAUD) - 1;
+
+	// 8N1 (p.165)
+	UCSRC = (1 << URSEL) | (1 << UCSZ1) | (1 << UCSZ0);
+
+	// transmitter for control bytes and telemetry
+	UCSRB = (1 << TXEN);
+#if UART_STREAM || UART_UPLOAD
+	// receiver with interrupt for pcm or upload frames
+	UCSRB |= (1 << RXEN) | (1 << RXCIE);
+#endif
+}
+
+// single SBI, no need to lock
+void uart_tx_kick()
+{
+	UCSRB |= (1 << UDRIE);
+}
+
+ISR(USART_UDRE_vect)
+{
+	uint8_t b = s_tx_ctrl;
+
+	if (b)
+		s_tx_ctrl = 0;
+#if TELEMETRY
+	else if (!tm_next_byte(&b))
+#else
+	else
+#endif
+	{
+		// nothing to send
+		UCSRB &= ~(1 << UDRIE);
+		return;
+	}
+	UDR = b;
+}
+
+// single byte store, no need to lock either
+void uart_send_ctrl(uint8_t b)
+{
+	s_tx_ctrl = b;
+	uart_tx_kick();
+}
+
+#if UART_STREAM
+static uint8_t rx_fill()
+{
+	return s_rx_head - s_rx_tail;
+}
+#endif
+
+#if UART_STREAM || UART_UPLOAD
+ISR(USART_RXC_vect)
+{
+	uint8_t b = UDR;
+	uint8_t head = s_rx_head;
+
+	// host ignored XOFF or sent a frame without waiting for ACK
+	if ((uint8_t)(head + 1) == s_rx_tail) {
+		++s_rx_overruns;
+		return;
+	}
+	s_rx[head] = b;
+	s_rx_head = head + 1;
+
+#if UART_STREAM
+	if (!s_xoff && rx_fill() >= RX_HIGH) {
+		s_xoff = 1;
+		uart_send_ctrl(XOFF);
+	}
+#endif
+}
+
+uint16_t uart_rx_overruns()
+{
+	return s_rx_overruns;
+}
+#endif
+
+#if UART_UPLOAD
+uint8_t uart_getc(uint8_t* b)
+{
+	uint8_t tail = s_rx_tail;
+
+	if (tail == s_rx_head)
+		return 0;
+	*b = s_rx[tail];
+	s_rx_tail = tail + 1;
+
+	return 1;
+}
+#endif
+
+#if UART_STREAM
+
+uint8_t uart_stream_ready()
+{
+	if (s_playing || rx_fill() < RX_PREFILL)
+		return 0;
+	s_starve = 0;
+	s_playing = 1;
+	return 1;
+}
+
+uint8_t uart_stream_read(uint8_t* sample)
+{
+	uint8_t tail = s_rx_tail;
+
+	if (tail == s_rx_head) {
+		if (++s_starve == STARVE_MAX) {
+			s_playing = 0;
+			return stream_eof;
+		}
+		// count each starvation once
+		if (s_starve == 1)
+			++s_rx_underruns;
+		// fade the last sample out to the midpoint
+		s_last -= (int8_t)(s_last - 0x80) >> 2;
+		*sample = s_last;
+		return stream_underrun;
+	}
+
+	s_starve = 0;
+	s_last = s_rx[tail];
+	s_rx_tail = tail + 1;
+	*sample = s_last;
+
+	if (s_xoff && rx_fill() <= RX_LOW) {
+		s_xoff = 0;
+		uart_send_ctrl(XON);
+	}
+
+	return stream_ok;
+}
+
+uint16_t uart_rx_underruns()
+{
+	return s_rx_underruns;
+}
+#endif
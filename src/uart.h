@@ -0,0 +1,50 @@
+#ifndef UART_H
+#define UART_H
+
+#include <avr/io.h>
+
+/*
+ * USART, 250000 baud 8N1, exact at 8MHz with U2X (p.150)
+ *
+ * RXD -> PD0
+ * TXD -> PD1
+ *
+ * TX carries flow control or upload ACK/NAK and telemetry records,
+ * see telemetry.h.
+ *
+ * Host streams 8-bit unsigned 8kHz pcm, tools/uartplay.py.
+ * Received bytes go to a 256 byte ring which is also the jitter
+ * buffer: playback starts when it is half full, host is throttled
+ * with XOFF/XON when it is 3/4 full / 1/4 full.
+ *
+ * Or (UART_UPLOAD=1) the same ring receives upload frames, see
+ * upload.h, both can't be built in at once.
+ */
+
+#define UART_BAUD 250000
+
+#define XON  0x11
+#define XOFF 0x13
+
+void uart_init();
+
+// TX has something to send, flow control or telemetry
+void uart_tx_kick();
+
+// single control byte, goes before telemetry
+void uart_send_ctrl(uint8_t b);
+
+// main loop, true once when enough pcm is buffered to start playback
+uint8_t uart_stream_ready();
+
+// sample ISR, conceals underruns by fading the last sample,
+// stream_eof when host stopped sending
+uint8_t uart_stream_read(uint8_t* sample);
+
+uint16_t uart_rx_underruns();
+uint16_t uart_rx_overruns();
+
+// main loop, next received byte, 0 if there is none
+uint8_t uart_getc(uint8_t* b);
+
+#endif //UART_H
@@ -0,0 +1,147 @@
+#include <util/atomic.h>
+#include <util/crc16.h>
+
+#include "fedordesk.h"
+#include "nvm.h"
+#include "uart.h"
+#include "upload.h"
+
+#define SYNC    'F'
+#define HEADER  5 // sync, cmd, addr, len
+#define CRC     2
+
+static uint8_t s_frame[HEADER + UPLOAD_PAYLOAD_MAX + CRC];
+static uint8_t s_len;
+
+// 'W' in progress, frame is kept in the buffer as the source
+enum {
+	write_none = 0,
+	write_queued,  // writer is busy with the state log
+	write_started
+};
+static uint8_t s_writing;
+static uint16_t s_addr;
+
+static uint16_t crc16(uint16_t crc, const uint8_t* p, uint8_t len)
+{
+	while (len--)
+		crc = _crc_xmodem_update(crc, *p++);
+	return crc;
+}
+
+// range is within the image, addr + len could wrap, so it is never
+// summed, an addr below the image wraps to a huge offset
+static uint8_t in_image(uint16_t addr, uint16_t len)
+{
+	uint16_t off = addr - NVM_IMAGE;
+
+	return off <= NVM_IMAGE_SIZE && len <= NVM_IMAGE_SIZE - off;
+}
+
+static uint8_t verify(uint16_t addr, uint16_t length, uint16_t crc)
+{
+	uint16_t c = 0;
+
+	if (!in_image(addr, length))
+		return NAK;
+	while (length--)
+		c = _crc_xmodem_update(c, nvm_read(addr++));
+	return c == crc ? ACK : NAK;
+}
+
+static uint8_t load()
+{
+	uint8_t ok = nvm_init();
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		desk_reload_pattern();
+	}
+	return ok ? ACK : NAK;
+}
+
+// whole frame is received, ACK, NAK or 0 if 'W' has started
+static uint8_t execute()
+{
+	uint8_t cmd = s_frame[1];
+	uint16_t addr = s_frame[2] | (s_frame[3] << 8);
+	uint8_t len = s_frame[4];
+	const uint8_t* payload = &s_frame[HEADER];
+	uint16_t crc = payload[len] | (payload[len + 1] << 8);
+
+	if (crc16(0, &s_frame[1], HEADER - 1 + len) != crc)
+		return NAK;
+
+	switch (cmd) {
+	case 'W':
+		if (!in_image(addr, len))
+			return NAK;
+		// don't play what is being rewritten
+		nvm_reset();
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+			desk_reload_pattern();
+		}
+		s_addr = addr;
+		return 0;
+	case 'V':
+		if (len != 4)
+			return NAK;
+		return verify(addr, payload[0] | (payload[1] << 8),
+					  payload[2] | (payload[3] << 8));
+	case 'L':
+		return load();
+	}
+	return NAK;
+}
+
+// true when 'W' is written
+static uint8_t write_poll()
+{
+	if (s_writing == write_queued) {
+		if (nvm_write(s_addr, &s_frame[HEADER], s_frame[4]))
+			s_writing = write_started;
+		return 0;
+	}
+	return nvm_idle();
+}
+
+void upload_poll()
+{
+	uint8_t b, reply;
+
+	if (s_writing) {
+		if (!write_poll())
+			return;
+		s_writing = write_none;
+		s_len = 0;
+		uart_send_ctrl(ACK);
+	}
+
+	for (;;) {
+		// whole frame waits while a state save writes EEPROM, 'V'
+		// and 'L' read it, the main loop goes on meanwhile
+		if (s_len >= HEADER && s_len == HEADER + s_frame[4] + CRC) {
+			if (!nvm_idle())
+				return;
+			reply = execute();
+			if (!reply) {
+				s_writing = write_queued;
+				return;
+			}
+			s_len = 0;
+			uart_send_ctrl(reply);
+			continue;
+		}
+
+		if (!uart_getc(&b))
+			return;
+		// look for the frame start
+		if (!s_len && b != SYNC)
+			continue;
+		s_frame[s_len++] = b;
+
+		if (s_len == HEADER && s_frame[4] > UPLOAD_PAYLOAD_MAX) {
+			s_len = 0;
+			uart_send_ctrl(NAK);
+		}
+	}
+}
@@ -0,0 +1,34 @@
+#ifndef UPLOAD_H
+#define UPLOAD_H
+
+#include <avr/io.h>
+
+/*
+ * Upload of EEPROM content over USART, tools/ledupload.py
+ *
+ * Frame, little endian:
+ *
+ *   'F' cmd addr[2] len payload[len] crc[2]
+ *
+ * crc is CRC-XMODEM of cmd .. payload. Every frame is answered
+ * with ACK or NAK, host sends the next one only after that.
+ *
+ *   'W'  write payload to EEPROM at addr, image is not used
+ *        till it is loaded again
+ *   'V'  payload is { u16 length, u16 crc }, check CRC-XMODEM of
+ *        EEPROM [addr, addr + length)
+ *   'L'  load the image, NAK if it is not valid
+ *
+ * EEPROM is written in background, see nvm.h, ACK of 'W' is sent
+ * when the last byte is written.
+ */
+
+#define UPLOAD_PAYLOAD_MAX 64
+
+#define ACK 0x06
+#define NAK 0x15
+
+// main loop
+void upload_poll();
+
+#endif //UPLOAD_H
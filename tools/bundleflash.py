@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+#
+# bundleflash.py -- update the flash asset bundle through the updater
+#                   of the boot section, see src/boot.c
+#
+# Usage:
+#   bundleflash.py [-b BAUD] [-a] PORT BUNDLE
+#
+# PORT is a serial device or the pty printed by sim/fedorsim -u,
+# BUNDLE is bundle.bin of tools/mkbundle.py. Hold button 0 and reset
+# the board, the updater answers hellos until then.
+#
+# The bundle is cut into 128 byte flash pages, the last one is padded
+# with 0xff. CRC of every page in flash is asked first, only pages of
+# another CRC are sent, so a new clip or pattern rewrites the pages it
+# moved and no more. A page goes in ~6ms at 250000 baud, a full 12K
+# bundle in about a second, audio only changes are well under it.
+#
+#   -a  send all pages, CRCs aren't asked
+#
+# The application starts once the bundle is in.
+#
+
+import argparse
+import struct
+import sys
+import time
+
+import ledupload
+
+PAGE = 128
+# longest frame of the updater
+FLUSH = b'\0' * (5 + PAGE + 2)
+RETRIES = 3
+HELLO_S = 30
+
+
+def read(port, n, timeout):
+    # no more than n bytes, the crc may follow ACK
+    data = b''
+    end = time.monotonic() + timeout
+    while len(data) < n and time.monotonic() < end:
+        data += port.read(n - len(data))
+    return data
+
+
+def request(port, cmd, addr, payload=b'', extra=0):
+    # extra reply bytes after ACK, None if it never comes
+    for _ in range(RETRIES):
+        port.write(ledupload.frame(cmd, addr, payload))
+        r = read(port, 1, 0.2)
+        if r == bytes([ledupload.ACK]):
+            data = read(port, extra, 0.1)
+            if len(data) == extra:
+                return data
+        # NAK of a broken frame or a page which didn't take goes again
+        port.write(FLUSH)
+        time.sleep(0.05)
+        port.reset_input_buffer()
+    return None
+
+
+def hello(port):
+    print('hold button 0 and reset the board', file=sys.stderr)
+    end = time.monotonic() + HELLO_S
+    while time.monotonic() < end:
+        port.write(ledupload.frame(b'H', 0))
+        if ledupload.reply(port, 0.2) == ledupload.ACK:
+            port.reset_input_buffer()
+            return
+    sys.exit('no updater on the port')
+
+
+def update(port, bundle, all_pages):
+    start = time.monotonic()
+    bundle += b'\xff' * (-len(bundle) % PAGE)
+    written = 0
+    for addr in range(0, len(bundle), PAGE):
+        page = bundle[addr:addr + PAGE]
+        if not all_pages:
+            crc = request(port, b'C', addr, extra=2)
+            if crc is None:
+                sys.exit('crc of page 0x%04x failed' % addr)
+            if struct.unpack('<H', crc)[0] == ledupload.crc16(page):
+                continue
+        if request(port, b'P', addr, page) is None:
+            sys.exit('write of page 0x%04x failed' % addr)
+        written += 1
+    if request(port, b'G', 0) is None:
+        sys.exit('application did not start')
+    print('%d of %d pages written in %.2fs' %
+          (written, len(bundle) // PAGE, time.monotonic() - start),
+          file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Update the FedorDesk asset bundle')
+    ap.add_argument('-b', '--baud', type=int, default=250000)
+    ap.add_argument('-a', '--all', action='store_true',
+                    help='write all pages')
+    ap.add_argument('port')
+    ap.add_argument('bundle')
+    args = ap.parse_args()
+
+    with open(args.bundle, 'rb') as f:
+        bundle = f.read()
+    if not bundle:
+        sys.exit('empty bundle')
+
+    import serial
+    port = serial.Serial(args.port, args.baud, timeout=0)
+    hello(port)
+    update(port, bundle, args.all)
+
+
+if __name__ == '__main__':
+    main()
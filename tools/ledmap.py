@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+#
+# ledmap.py -- generate ledmap.h, led matrix geometry and pin mapping
+#              for the firmware refresh engine (src/leds.c)
+#
+# Usage:
+#   ledmap.py -o ledmap.h -c PINS -l PINS [-g GROUP]
+#   ledmap.py -o ledmap.h -x PINS -n COLUMNSxLAYERS
+#
+#   -c  column pins, LED0 first, e.g. PA0-7,PC0-3, up to 16
+#   -l  layer ground pins, layer 0 first, e.g. PC4-6, up to 8
+#   -g  leds lit at a time, i.e. current limit, 6 by default
+#   -x  charlieplexed pins of one port, e.g. PA0-6
+#   -n  geometry of charlieplexed leds, e.g. 12x3
+#
+# PINS is a comma separated list of PXn or PXn-m. Buttons (PD2, PD3,
+# PB2) and the speaker (PD7) can't be used. Pins of optional
+# features are exported as LEDMAP_PINS_<PORT>, so USART (PD0-1),
+# serial flash (PB4-7) and the ISR probe (PD6) refuse to build
+# on top of leds.
+#
+# Columns mapped to consecutive bits of one port become a single
+# shift and mask, so the refresh cost grows with the number of such
+# runs, not with the number of leds.
+#
+# Charlieplexed N pins drive N*(N-1) leds, one per ordered pin pair:
+# anode high, cathode low, the rest tri-stated. Led (layer, column)
+# is pair number layer * columns + column, anodes in pin order, i.e.
+#   PA0->PA1, PA0->PA2, ..., PA1->PA0, PA1->PA2, ...
+# The 12x3 desk takes 7 pins instead of 15.
+#
+
+import argparse
+import re
+import sys
+
+PORTS = 'ABCD'
+COLUMNS_MAX = 16
+LAYERS_MAX = 8
+RESERVED = {('D', 2): 'button0', ('D', 3): 'button1', ('B', 2): 'button2',
+            ('D', 7): 'speaker'}
+
+
+def parse_pins(spec):
+    pins = []
+    for item in spec.split(','):
+        m = re.match(r'^P([A-D])([0-7])(?:-([0-7]))?$', item.strip().upper())
+        if not m:
+            raise argparse.ArgumentTypeError("bad pin '%s'" % item)
+        port, first, last = m.group(1), int(m.group(2)), m.group(3)
+        last = int(last) if last is not None else first
+        if last < first:
+            raise argparse.ArgumentTypeError("bad pin range '%s'" % item)
+        pins += [(port, bit) for bit in range(first, last + 1)]
+    return pins
+
+
+def runs(pins):
+    # (port, first bit, first index, count) of consecutive bits
+    out = []
+    for i, (port, bit) in enumerate(pins):
+        if out and out[-1][0] == port and \
+           out[-1][1] + out[-1][3] == bit and out[-1][2] + out[-1][3] == i:
+            out[-1][3] += 1
+        else:
+            out.append([port, bit, i, 1])
+    return out
+
+
+def port_masks(pins):
+    masks = dict((p, 0) for p in PORTS)
+    for port, bit in pins:
+        masks[port] |= 1 << bit
+    return masks
+
+
+def generate(columns, layers, group, cmdline):
+    cols = port_masks(columns)
+    lays = port_masks(layers)
+    slots = (len(columns) + group - 1) // group
+
+    out = []
+    out.append('#ifndef LEDMAP_H')
+    out.append('#define LEDMAP_H')
+    out.append('')
+    out.append('// generated by:')
+    out.append('//   $ %s' % cmdline)
+    out.append('')
+    out.append('#include <avr/io.h>')
+    out.append('')
+    out.append('#define LEDS_NUM    %d' % len(columns))
+    out.append('#define LAYERS_NUM  %d' % len(layers))
+    out.append('')
+    out.append('#define LEDMAP_CHARLIE 0')
+    out.append('')
+    out.append('// leds lit at a time and refresh slots to light all of them')
+    out.append('#define LEDS_GROUP  %d' % group)
+    out.append('#define LED_SLOTS   %d' % slots)
+    out.append('')
+    out.append('// pins taken by leds')
+    for p in PORTS:
+        out.append('#define LEDMAP_PINS_%s 0x%02x' % (p, cols[p] | lays[p]))
+    out.append('')
+    out.append('// columns of each refresh slot')
+    masks = []
+    for s in range(slots):
+        n = min(group, len(columns) - s * group)
+        masks.append('0x%04x' % (((1 << n) - 1) << (s * group)))
+    out.append('#define LED_SLOT_MASKS { %s }' % ', '.join(masks))
+    out.append('')
+
+    out.append('static inline void ledmap_init()')
+    out.append('{')
+    for p in PORTS:
+        if cols[p] | lays[p]:
+            out.append('\tDDR%s |= 0x%02x;' % (p, cols[p] | lays[p]))
+    out.append('}')
+    out.append('')
+
+    out.append('// columns and grounds to low')
+    out.append('static inline void ledmap_off()')
+    out.append('{')
+    for p in PORTS:
+        if cols[p] | lays[p]:
+            out.append('\tPORT%s &= 0x%02x;' % (p, ~(cols[p] | lays[p]) & 0xff))
+    out.append('}')
+    out.append('')
+
+    out.append('static inline void ledmap_columns(uint16_t leds)')
+    out.append('{')
+    for port, bit, index, count in runs(columns):
+        mask = ((1 << count) - 1) << bit
+        shift = index - bit
+        if shift > 0:
+            expr = 'leds >> %d' % shift
+        elif shift < 0:
+            expr = 'leds << %d' % -shift
+        else:
+            expr = 'leds'
+        out.append('\tPORT%s |= (uint8_t)(%s) & 0x%02x;' % (port, expr, mask))
+    out.append('}')
+    out.append('')
+
+    out.append('static inline void ledmap_layer(uint8_t y)')
+    out.append('{')
+    layer_runs = runs(layers)
+    if len(layer_runs) == 1:
+        port, bit, _, _ = layer_runs[0]
+        out.append('\tPORT%s |= 1 << (y + %d);' % (port, bit) if bit else
+                   '\tPORT%s |= 1 << y;' % port)
+    else:
+        out.append('\tswitch (y) {')
+        for y, (port, bit) in enumerate(layers):
+            out.append('\tcase %d:' % y)
+            out.append('\t\tPORT%s |= 1 << %d;' % (port, bit))
+            out.append('\t\tbreak;')
+        out.append('\t}')
+    out.append('}')
+    out.append('')
+    out.append('#endif //LEDMAP_H')
+    return '\n'.join(out) + '\n'
+
+
+def generate_charlie(pins, columns, layers, cmdline):
+    port = pins[0][0]
+    bits = [bit for _, bit in pins]
+    mask = port_masks(pins)[port]
+
+    out = []
+    out.append('#ifndef LEDMAP_H')
+    out.append('#define LEDMAP_H')
+    out.append('')
+    out.append('// generated by:')
+    out.append('//   $ %s' % cmdline)
+    out.append('')
+    out.append('#include <avr/io.h>')
+    out.append('')
+    out.append('#define LEDS_NUM    %d' % columns)
+    out.append('#define LAYERS_NUM  %d' % layers)
+    out.append('')
+    out.append('// charlieplexed, one refresh slot per anode pin')
+    out.append('#define LEDMAP_CHARLIE 1')
+    out.append('#define CHARLIE_PINS   %d' % len(pins))
+    out.append('#define CHARLIE_DDR    DDR%s' % port)
+    out.append('#define CHARLIE_PORT   PORT%s' % port)
+    out.append('#define CHARLIE_MASK   0x%02x' % mask)
+    out.append('')
+    out.append('// pins taken by leds')
+    for p in PORTS:
+        out.append('#define LEDMAP_PINS_%s 0x%02x' % (p, mask if p == port else 0))
+    out.append('')
+    out.append('// anode pin bit of every slot')
+    out.append('#define CHARLIE_ANODES { %s }' %
+               ', '.join('0x%02x' % (1 << bit) for bit in bits))
+    out.append('')
+    out.append('// slot << 4 | cathode bit of every led, layer by layer')
+    pairs = [(a, c) for a in range(len(bits)) for c in range(len(bits)) if a != c]
+    out.append('#define CHARLIE_LEDS { \\')
+    for y in range(layers):
+        row = pairs[y * columns:(y + 1) * columns]
+        out.append('\t{ %s }, \\' % ', '.join('0x%02x' % (a << 4 | bits[c])
+                                               for a, c in row))
+    out.append('}')
+    out.append('')
+
+    out.append('// tri-stated, no pull-ups')
+    out.append('static inline void ledmap_init()')
+    out.append('{')
+    out.append('\tDDR%s &= 0x%02x;' % (port, ~mask & 0xff))
+    out.append('\tPORT%s &= 0x%02x;' % (port, ~mask & 0xff))
+    out.append('}')
+    out.append('')
+    out.append('#endif //LEDMAP_H')
+    return '\n'.join(out) + '\n'
+
+
+def charlie_main(ap, args):
+    m = re.match(r'^(\d+)x(\d+)$', args.geometry or '')
+    if not m:
+        ap.error('charlieplexed geometry is -n COLUMNSxLAYERS')
+    columns, layers = int(m.group(1)), int(m.group(2))
+    pins = args.charlie
+    if not 0 < columns <= COLUMNS_MAX:
+        ap.error('1..%d columns' % COLUMNS_MAX)
+    if not 0 < layers <= LAYERS_MAX:
+        ap.error('1..%d layers' % LAYERS_MAX)
+    if len(set(port for port, _ in pins)) != 1:
+        ap.error('charlieplexed pins are of one port')
+    if columns * layers > len(pins) * (len(pins) - 1):
+        ap.error('%d pins drive %d leds, not %d' %
+                 (len(pins), len(pins) * (len(pins) - 1), columns * layers))
+    for pin in pins:
+        if pin in RESERVED:
+            ap.error('P%s%d is %s' % (pin[0], pin[1], RESERVED[pin]))
+        if pins.count(pin) > 1:
+            ap.error('P%s%d is used twice' % pin)
+
+    cmdline = ' '.join(['ledmap.py'] + sys.argv[1:])
+    with open(args.output, 'w') as f:
+        f.write(generate_charlie(pins, columns, layers, cmdline))
+
+    print('%dx%d leds, %d charlieplexed pins, %d slots' %
+          (columns, layers, len(pins), len(pins)), file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Generate led pin mapping')
+    ap.add_argument('-o', '--output', required=True, help='header to generate')
+    ap.add_argument('-c', '--columns', type=parse_pins)
+    ap.add_argument('-l', '--layers', type=parse_pins)
+    ap.add_argument('-g', '--group', type=int, default=6)
+    ap.add_argument('-x', '--charlie', type=parse_pins,
+                    help='charlieplexed pins instead of columns and layers')
+    ap.add_argument('-n', '--geometry', help='charlieplexed COLUMNSxLAYERS')
+    args = ap.parse_args()
+
+    if args.charlie:
+        if args.columns or args.layers:
+            ap.error('-x excludes -c and -l')
+        charlie_main(ap, args)
+        return
+    if not args.columns or not args.layers:
+        ap.error('-c and -l are required')
+
+    if not 0 < len(args.columns) <= COLUMNS_MAX:
+        ap.error('1..%d columns' % COLUMNS_MAX)
+    if not 0 < len(args.layers) <= LAYERS_MAX:
+        ap.error('1..%d layers' % LAYERS_MAX)
+    if args.group < 1:
+        ap.error('group is at least 1')
+    pins = args.columns + args.layers
+    for pin in pins:
+        if pin in RESERVED:
+            ap.error('P%s%d is %s' % (pin[0], pin[1], RESERVED[pin]))
+        if pins.count(pin) > 1:
+            ap.error('P%s%d is used twice' % pin)
+
+    cmdline = ' '.join(['ledmap.py'] + sys.argv[1:])
+    with open(args.output, 'w') as f:
+        f.write(generate(args.columns, args.layers, args.group, cmdline))
+
+    print('%dx%d leds, %d slots, %d column runs' %
+          (len(args.columns), len(args.layers),
+           (len(args.columns) + args.group - 1) // args.group,
+           len(runs(args.columns))), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
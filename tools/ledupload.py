@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+#
+# ledupload.py -- upload led patterns and the button press clip to
+#                 the firmware EEPROM over USART (make UART_UPLOAD=1)
+#
+# Usage:
+#   ledupload.py [-b BAUD] [-o IMAGE] PATTERNS [PORT]
+#
+# PORT is a serial device or the pty printed by sim/fedorsim -u,
+# with -o the EEPROM image is written to a file instead, e.g. for
+#   $ make -C src eeprom
+#
+# PATTERNS is a text file, '#' starts a comment:
+#
+#   pattern 0              # button 0..2, replaces the built-in one
+#   0 *...........         # LAYER LEDS, LED11 first, '*' or 1 is on
+#   0 .*..........  2      # optional BEATS the frame lasts, 1..32
+#   0 ............
+#   clip press.raw         # optional, 8-bit unsigned 8kHz pcm
+#
+# Frames of a pattern are looped, each is shown for BEATS of the speed
+# tempo, one by default. Beats go to the layer byte, see src/nvm.h.
+#
+# Image layout, see src/nvm.h: header, then patterns { u8 frames
+# number, frames { u8 layer, u16 leds } }, then the clip. Image is
+# written in frames of src/upload.h, each is acknowledged, then
+# verified by CRC and loaded. EEPROM takes 8.5ms per changed byte,
+# so a couple of patterns go in well under a second.
+#
+
+import argparse
+import binascii
+import struct
+import sys
+import time
+
+MAGIC = 0x4446
+VERSION = 1
+IMAGE_SIZE = 0x180
+HEADER = '<HBBHH3HHH'
+BUTTONS_NUM = 3
+LEDS_NUM = 12
+LAYERS_NUM = 3
+BEATS_MAX = 32
+
+SYNC = b'F'
+PAYLOAD_MAX = 64
+CHUNK = 32
+ACK = 0x06
+NAK = 0x15
+RETRIES = 3
+# longest frame, zeros push a half received frame out of the firmware
+FLUSH = b'\0' * (5 + PAYLOAD_MAX + 2)
+
+
+def crc16(data):
+    # CRC-XMODEM, the same as _crc_xmodem_update()
+    return binascii.crc_hqx(data, 0)
+
+
+def parse(path):
+    patterns = {}
+    clip = b''
+    frames = None
+    with open(path) as f:
+        for n, line in enumerate(f, 1):
+            words = line.split('#', 1)[0].split()
+            if not words:
+                continue
+
+            def error(msg):
+                sys.exit('%s:%d: %s' % (path, n, msg))
+
+            if words[0] == 'pattern':
+                if len(words) != 2 or not words[1].isdigit() or \
+                   int(words[1]) >= BUTTONS_NUM:
+                    error('pattern 0..%d expected' % (BUTTONS_NUM - 1))
+                frames = patterns.setdefault(int(words[1]), [])
+            elif words[0] == 'clip':
+                if len(words) != 2:
+                    error('clip FILE expected')
+                with open(words[1], 'rb') as c:
+                    clip = c.read()
+            else:
+                if frames is None:
+                    error('frame outside of a pattern')
+                if not 2 <= len(words) <= 3 or not words[0].isdigit() or \
+                   int(words[0]) >= LAYERS_NUM:
+                    error('LAYER LEDS [BEATS] expected')
+                bits = words[1]
+                if len(bits) != LEDS_NUM or set(bits) - set('*.10'):
+                    error('%d leds of * . 1 0 expected' % LEDS_NUM)
+                leds = int(''.join('1' if b in '*1' else '0' for b in bits), 2)
+                beats = words[2] if len(words) == 3 else '1'
+                if not beats.isdigit() or not 1 <= int(beats) <= BEATS_MAX:
+                    error('BEATS 1..%d expected' % BEATS_MAX)
+                frames.append(((int(beats) - 1) << 3 | int(words[0]), leds))
+    return patterns, clip
+
+
+def build(patterns, clip):
+    size = struct.calcsize(HEADER)
+    body = bytearray()
+    offsets = [0] * BUTTONS_NUM
+    for b, frames in sorted(patterns.items()):
+        if not 0 < len(frames) < 256:
+            sys.exit('pattern %d: 1..255 frames expected' % b)
+        offsets[b] = size + len(body)
+        body += bytes([len(frames)])
+        for layer, leds in frames:
+            body += struct.pack('<BH', layer, leds)
+    clip_offset = size + len(body) if clip else 0
+    body += clip
+
+    length = size + len(body)
+    if length > IMAGE_SIZE:
+        sys.exit('image is %d bytes, EEPROM has %d for it' %
+                 (length, IMAGE_SIZE))
+    header = struct.pack(HEADER, MAGIC, VERSION, 0, length, crc16(body),
+                         *offsets, clip_offset, len(clip))
+    return header + body
+
+
+def frame(cmd, addr, payload=b''):
+    data = cmd + struct.pack('<HB', addr, len(payload)) + payload
+    return SYNC + data + struct.pack('<H', crc16(data))
+
+
+def reply(port, timeout):
+    # telemetry records have the top bit set, skip them
+    end = time.monotonic() + timeout
+    while time.monotonic() < end:
+        for b in port.read(port.in_waiting or 1):
+            if b in (ACK, NAK):
+                return b
+    return None
+
+
+def send(port, cmd, addr, payload=b''):
+    # 'W' is acknowledged when EEPROM is written
+    timeout = 0.1 + 0.0085 * len(payload)
+    for _ in range(RETRIES):
+        port.write(frame(cmd, addr, payload))
+        r = reply(port, timeout)
+        if r == ACK:
+            return True
+        if r == NAK and cmd != b'W':
+            return False
+        port.write(FLUSH)
+        time.sleep(0.05)
+        port.reset_input_buffer()
+    return False
+
+
+def upload(port, image):
+    start = time.monotonic()
+    for addr in range(0, len(image), CHUNK):
+        if not send(port, b'W', addr, image[addr:addr + CHUNK]):
+            sys.exit('write at %d failed' % addr)
+    if not send(port, b'V', 0, struct.pack('<HH', len(image), crc16(image))):
+        sys.exit('verify failed')
+    if not send(port, b'L', 0):
+        sys.exit('firmware rejected the image')
+    print('%d bytes in %.2fs' % (len(image), time.monotonic() - start),
+          file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Upload led patterns to FedorDesk')
+    ap.add_argument('-b', '--baud', type=int, default=250000)
+    ap.add_argument('-o', '--output', help='write EEPROM image to a file')
+    ap.add_argument('patterns')
+    ap.add_argument('port', nargs='?')
+    args = ap.parse_args()
+
+    if not args.output and not args.port:
+        ap.error('PORT or -o is needed')
+
+    image = build(*parse(args.patterns))
+    if args.output:
+        with open(args.output, 'wb') as f:
+            f.write(image)
+    if args.port:
+        # not needed by tools/mkbundle.py, which imports parse()
+        import serial
+        upload(serial.Serial(args.port, args.baud, timeout=0), image)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+#
+# lzpack.py -- lossless LZ block codec of flash assets, see src/lz.h,
+#              prints the ratio of every file
+#
+# Usage:
+#   lzpack.py FILE [FILE ...]
+#
+# Also a module: sndpack.py packs the sample pool with pack().
+#
+# Tokens, a packed block is a run of them:
+#   0lllllll           literal run of l + 1 bytes, the bytes follow
+#   1lllllll DIST16    match of l + LZ_MIN_MATCH bytes at DIST bytes
+#                      before the token, little endian
+# Matches copy from literal runs of the packed stream itself, not
+# from unpacked data, so the decoder reads flash only, no RAM window.
+# A match lies within one literal run of any earlier block.
+#
+# Every LZ_BLOCK bytes of unpacked data start a new token, the seek
+# table holds the packed offset of every block.
+#
+
+import argparse
+import sys
+
+# src/lz.h
+LZ_BLOCK = 128
+LZ_MIN_MATCH = 3
+LZ_MATCH = 0x80
+
+MAX_LITERAL = 0x80
+MAX_MATCH = 0x7f + LZ_MIN_MATCH
+# a match token is 3 bytes, shorter ones don't pay
+MIN_GAIN_MATCH = 4
+# candidates tried per position, newest first
+MAX_CHAIN = 64
+
+
+class Packer:
+    def __init__(self):
+        self.out = bytearray()
+        # LZ_MIN_MATCH bytes -> (offset, end of its literal run)
+        self.index = {}
+
+    def literals(self, data):
+        for i in range(0, len(data), MAX_LITERAL):
+            run = data[i:i + MAX_LITERAL]
+            self.out.append(len(run) - 1)
+            start = len(self.out)
+            self.out += run
+            end = len(self.out)
+            for k in range(start, end - LZ_MIN_MATCH + 1):
+                key = bytes(self.out[k:k + LZ_MIN_MATCH])
+                self.index.setdefault(key, []).append((k, end))
+
+    def longest(self, data, i):
+        best, best_at = 0, 0
+        key = bytes(data[i:i + LZ_MIN_MATCH])
+        for k, end in reversed(self.index.get(key, [])[-MAX_CHAIN:]):
+            n = 0
+            while n < MAX_MATCH and i + n < len(data) and k + n < end and \
+                  self.out[k + n] == data[i + n]:
+                n += 1
+            if n > best:
+                best, best_at = n, k
+        return best, best_at
+
+    def block(self, data):
+        lits = bytearray()
+        i = 0
+        while i < len(data):
+            n, at = self.longest(data, i)
+            # distance fits 16 bits, so does the whole stream
+            if n >= MIN_GAIN_MATCH:
+                self.literals(lits)
+                lits = bytearray()
+                dist = len(self.out) - at
+                self.out.append(LZ_MATCH | (n - LZ_MIN_MATCH))
+                self.out += bytes((dist & 0xff, dist >> 8))
+                i += n
+            else:
+                lits.append(data[i])
+                i += 1
+        self.literals(lits)
+
+
+def pack(data):
+    # packed stream and seek table
+    p = Packer()
+    blocks = []
+    for i in range(0, len(data), LZ_BLOCK):
+        blocks.append(len(p.out))
+        p.block(data[i:i + LZ_BLOCK])
+    if len(p.out) > 0xffff:
+        sys.exit('packed stream is too big: %d bytes' % len(p.out))
+    return bytes(p.out), blocks
+
+
+def unpack(packed, blocks, length):
+    # as src/lz.c does, block by block from the seek table
+    out = bytearray()
+    for b, src in enumerate(blocks):
+        end = min(length, (b + 1) * LZ_BLOCK)
+        while len(out) < end:
+            t = packed[src]
+            if t & LZ_MATCH:
+                n = (t & ~LZ_MATCH) + LZ_MIN_MATCH
+                copy = src - (packed[src + 1] | packed[src + 2] << 8)
+                src += 3
+            else:
+                n = t + 1
+                copy = src + 1
+                src = copy + n
+            out += packed[copy:copy + n]
+    return bytes(out)
+
+
+def packed_size(blocks, packed, start, length):
+    # packed bytes and seek table entries of the blocks of a range
+    first = start // LZ_BLOCK
+    last = (start + length - 1) // LZ_BLOCK + 1
+    end = blocks[last] if last < len(blocks) else len(packed)
+    return end - blocks[first] + 2 * (last - first)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='LZ block codec ratio')
+    ap.add_argument('files', nargs='+', metavar='FILE')
+    args = ap.parse_args()
+
+    for path in args.files:
+        with open(path, 'rb') as f:
+            data = f.read()
+        if not data:
+            continue
+        packed, blocks = pack(data)
+        if unpack(packed, blocks, len(data)) != data:
+            sys.exit('%s: does not unpack' % path)
+        size = len(packed) + 2 * len(blocks)
+        print('%s: %d -> %d bytes, %d%%' %
+              (path, len(data), size, 100 * size // len(data)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+#
+# mkbundle.py -- build the flash asset bundle of the firmware
+#                (make ASSET_BUNDLE=1) from pcm clips and led patterns
+#
+# Usage:
+#   mkbundle.py -o bundle.bin -H assets.h [-z] [-s MAX] [-p PATTERNS]
+#               [-n COLUMNSxLAYERS] [-f MS] CLIP [CLIP ...]
+#
+# CLIP is the same as of sndpack.py, a .wav or raw pcm, clips are
+# deduplicated into one pool, then cues and beats are found the same
+# way. PATTERNS is a led pattern file of ledupload.py, its patterns
+# replace the built-in ones, its clip is ignored.
+#
+#   -z  pack the pool by the LZ block codec of lzpack.py, the
+#       firmware is to be built with SAMPLES_LZ=1
+#   -s  fail if the bundle is over MAX bytes, flash it is linked to
+#
+# Bundle layout, see src/bundle.h:
+#   0x00  "FDAB"
+#   0x04  version, u8
+#   0x05  assets number, u8
+#   0x06  bundle size, u16
+#   0x08  CRC-XMODEM of the bundle after the header, u16
+#   0x0a  { u8 type, u8 codec, u16 rate, u16 offset, u16 size,
+#           u16 length } per asset, the asset id is its index
+#   then asset data; pcm starts on a 128 byte flash page, so
+#   changes of the tables after it don't move it
+#
+# Asset ids are fixed: samples, clips, cues, beats, then a pattern
+# per button. LZ packed pcm is its seek table, then the stream.
+#
+# The header gets CLIP_<NAME> ids and CLIPS_NUM for the firmware.
+#
+
+import argparse
+import binascii
+import struct
+import sys
+
+import ledupload
+import lzpack
+import sndpack
+
+MAGIC = b'FDAB'
+VERSION = 1
+HEADER = '<4sBBHH'
+ASSET = '<BBHHHH'
+PAGE = 128
+
+# ids, src/bundle.h
+ASSET_SAMPLES = 0
+ASSET_CLIPS = 1
+ASSET_CUES = 2
+ASSET_BEATS = 3
+ASSET_PATTERN0 = 4
+ASSETS_NUM = ASSET_PATTERN0 + ledupload.BUTTONS_NUM
+
+# types and codecs
+ASSET_NONE = 0
+ASSET_PCM = 1
+ASSET_TABLE = 2
+ASSET_PATTERN = 3
+CODEC_RAW = 0
+CODEC_LZ = 1
+
+CLIP_LOOP = 1 << 0
+
+
+def crc16(data):
+    # CRC-XMODEM, the same as _crc_xmodem_update()
+    return binascii.crc_hqx(data, 0)
+
+
+class Asset:
+    def __init__(self, name, type=ASSET_NONE, data=b'', codec=CODEC_RAW,
+                 rate=0, length=None, page=False):
+        self.name = name
+        self.type = type
+        self.data = data
+        self.codec = codec
+        self.rate = rate
+        self.length = len(data) if length is None else length
+        self.page = page
+        self.offset = 0
+
+
+def sound_assets(clips, geometry, flash, lz):
+    for clip in clips:
+        clip.beats = sndpack.find_beats(clip.data, *geometry,
+                                        flash * sndpack.SAMPLE_RATE // 1000)
+    pool = sndpack.pack(clips)
+    if len(pool) > 0xffff:
+        sys.exit('pool is too big: %d bytes' % len(pool))
+
+    cues = []
+    for clip in clips:
+        clip.cue = len(cues)
+        cues += [clip.offset + c for c in clip.cues]
+    beats = sndpack.beat_table(clips)
+
+    # clip_t and beat_t of src/sound.h
+    table = b''.join(struct.pack('<HHBBHBB', c.offset, len(c.data), c.cue,
+                                 len(c.cues), c.beat, len(c.beats),
+                                 CLIP_LOOP if c.loop else 0) for c in clips)
+    samples = Asset('samples', ASSET_PCM, pool, rate=sndpack.SAMPLE_RATE,
+                    page=True)
+    if lz:
+        packed, blocks = lzpack.pack(pool)
+        if lzpack.unpack(packed, blocks, len(pool)) != pool:
+            sys.exit('packed pool does not unpack')
+        samples.data = struct.pack('<%dH' % len(blocks), *blocks) + packed
+        samples.codec = CODEC_LZ
+    return [
+        samples,
+        Asset('clips', ASSET_TABLE, table),
+        Asset('cues', ASSET_TABLE, struct.pack('<%dH' % len(cues), *cues)),
+        Asset('beats', ASSET_TABLE,
+              b''.join(struct.pack('<HBH', *b) for b in beats)),
+    ]
+
+
+def pattern_assets(path):
+    patterns = ledupload.parse(path)[0] if path else {}
+    assets = []
+    for b in range(ledupload.BUTTONS_NUM):
+        frames = patterns.get(b)
+        if not frames:
+            assets.append(Asset('pattern%d' % b))
+            continue
+        if len(frames) > 255:
+            sys.exit('pattern %d: 1..255 frames expected' % b)
+        data = bytes([len(frames)]) + \
+            b''.join(struct.pack('<BH', *f) for f in frames)
+        assets.append(Asset('pattern%d' % b, ASSET_PATTERN, data))
+    return assets
+
+
+def build(assets):
+    pos = struct.calcsize(HEADER) + len(assets) * struct.calcsize(ASSET)
+    for a in assets:
+        if a.page:
+            pos = (pos + PAGE - 1) // PAGE * PAGE
+        a.offset = pos if a.data else 0
+        pos += len(a.data)
+    if pos > 0xffff:
+        sys.exit('bundle is too big: %d bytes' % pos)
+
+    body = bytearray()
+    for a in assets:
+        body += struct.pack(ASSET, a.type, a.codec, a.rate, a.offset,
+                            len(a.data), a.length)
+    for a in assets:
+        if a.data:
+            body += b'\xff' * (a.offset - struct.calcsize(HEADER) - len(body))
+            body += a.data
+    size = struct.calcsize(HEADER) + len(body)
+    return struct.pack(HEADER, MAGIC, VERSION, len(assets), size,
+                       crc16(body)) + body
+
+
+def header(clips, cmdline):
+    out = []
+    out.append('#ifndef ASSETS_H')
+    out.append('#define ASSETS_H')
+    out.append('')
+    out.append('// clip ids of the asset bundle, generated by:')
+    out.append('//   $ %s' % cmdline)
+    out.append('')
+    for i, clip in enumerate(clips):
+        out.append('#define CLIP_%-10s %d' % (clip.name, i))
+    out.append('#define CLIPS_NUM       %d' % len(clips))
+    out.append('')
+    out.append('#endif //ASSETS_H')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build the flash asset bundle')
+    ap.add_argument('-o', '--output', required=True, help='bundle to write')
+    ap.add_argument('-H', '--header', required=True,
+                    help='header of clip ids to write')
+    ap.add_argument('-z', '--lz', action='store_true',
+                    help='pack the pool, SAMPLES_LZ=1')
+    ap.add_argument('-s', '--size', type=int, default=0,
+                    help='max bundle size, bytes')
+    ap.add_argument('-p', '--patterns', help='led patterns of ledupload.py')
+    ap.add_argument('-n', '--geometry', default='12x3',
+                    type=sndpack.parse_geometry,
+                    help='led COLUMNSxLAYERS of beat maps')
+    ap.add_argument('-f', '--flash', type=int, default=100,
+                    help='beat flash length, ms')
+    ap.add_argument('clips', nargs='+', type=sndpack.parse_clip,
+                    metavar='CLIP')
+    args = ap.parse_args()
+
+    assets = sound_assets(args.clips, args.geometry, args.flash, args.lz) + \
+        pattern_assets(args.patterns)
+    assert len(assets) == ASSETS_NUM
+    bundle = build(assets)
+
+    for i, a in enumerate(assets):
+        if a.data:
+            print('  %d %-10s %5d bytes at 0x%04x' %
+                  (i, a.name, len(a.data), a.offset), file=sys.stderr)
+    print('bundle: %d assets, %d bytes' % (len(assets), len(bundle)),
+          file=sys.stderr)
+    if args.size and len(bundle) > args.size:
+        sys.exit('bundle is over %d bytes' % args.size)
+
+    with open(args.output, 'wb') as f:
+        f.write(bundle)
+    cmdline = ' '.join(['mkbundle.py'] + sys.argv[1:])
+    with open(args.header, 'w') as f:
+        f.write(header(args.clips, cmdline))
+
+
+if __name__ == '__main__':
+    main()
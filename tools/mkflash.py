@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# mkflash.py -- build a 25-series serial flash image with tracks for
+#               the firmware stream (make SPI_FLASH=1)
+#
+# Usage:
+#   mkflash.py -o flash.bin TRACK [TRACK ...]
+#
+# TRACK is FILE[,loop], raw 8-bit unsigned 8kHz pcm, e.g. from
+#   $ sox file.mp3 -c1 -r8000 -e unsigned -b 8 out.raw
+# Tracks are assigned to buttons in order.
+#
+# Image layout, see src/stream.h:
+#   0x00  "FDSK"
+#   0x04  tracks number, u32
+#   0x08  { u32 addr, u32 length, u8 flags, u8 reserved[3] } per track
+#   then track data, each track starts on a 256 byte page
+#
+
+import argparse
+import struct
+
+MAGIC = b'FDSK'
+TRACKS_MAX = 3
+PAGE = 256
+CLIP_LOOP = 1 << 0
+
+
+def parse_track(spec):
+    path, _, flags = spec.partition(',')
+    if flags not in ('', 'loop'):
+        raise argparse.ArgumentTypeError("unknown track flag '%s'" % flags)
+    with open(path, 'rb') as f:
+        return f.read(), CLIP_LOOP if flags == 'loop' else 0
+
+
+def align(n):
+    return (n + PAGE - 1) // PAGE * PAGE
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build serial flash image')
+    ap.add_argument('-o', '--output', required=True, help='image to write')
+    ap.add_argument('-s', '--size', type=int, default=0,
+                    help='pad image with 0xff to SIZE bytes, i.e. chip size')
+    ap.add_argument('tracks', nargs='+', type=parse_track, metavar='TRACK')
+    args = ap.parse_args()
+
+    if len(args.tracks) > TRACKS_MAX:
+        ap.error('at most %d tracks' % TRACKS_MAX)
+
+    header = MAGIC + struct.pack('<I', len(args.tracks))
+    addr = align(len(header) + 12 * len(args.tracks))
+    data = bytearray()
+    for pcm, flags in args.tracks:
+        header += struct.pack('<IIB3x', addr, len(pcm), flags)
+        data += pcm + b'\xff' * (align(len(pcm)) - len(pcm))
+        addr += align(len(pcm))
+
+    image = header + b'\xff' * (align(len(header)) - len(header)) + data
+    if args.size:
+        if len(image) > args.size:
+            ap.error('image is %d bytes, chip is %d' % (len(image), args.size))
+        image += b'\xff' * (args.size - len(image))
+
+    with open(args.output, 'wb') as f:
+        f.write(image)
+
+    for i, (pcm, flags) in enumerate(args.tracks):
+        print('track %d: %d bytes, %.1fs%s' % (i, len(pcm), len(pcm) / 8000.0,
+              ', loop' if flags & CLIP_LOOP else ''))
+
+
+if __name__ == '__main__':
+    main()
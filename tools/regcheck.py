@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+#
+# regcheck.py -- fail if code not built with -ffixed, i.e. libgcc
+#                and avr-libc, touches registers reserved for the
+#                naked sample ISR (SAMPLE_ASM=1, see src/sample.h)
+#
+# Usage:
+#   regcheck.py -r "r2 r3 ..." fedordesk.elf FILE.o [FILE.o ...]
+#
+# Functions defined by FILE.o are ours and use the registers only
+# through global register variables, every other function of the
+# elf, i.e. the disassembly of avr-objdump -d, must not name them.
+# Library functions which save and restore them (call-saved r2-r17)
+# still corrupt them for an ISR in between, so they are errors too.
+#
+
+import argparse
+import re
+import subprocess
+import sys
+
+OBJDUMP = 'avr-objdump'
+NM = 'avr-nm'
+
+
+def run(*cmd):
+    return subprocess.run(cmd, check=True, stdout=subprocess.PIPE,
+                          universal_newlines=True).stdout
+
+
+def own_functions(objs):
+    names = set()
+    for line in run(NM, *objs).splitlines():
+        words = line.split()
+        if len(words) == 3 and words[1] in 'Tt':
+            names.add(words[2])
+    return names
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Check reserved registers')
+    ap.add_argument('-r', '--regs', required=True,
+                    help='reserved registers, e.g. "r2 r3"')
+    ap.add_argument('elf')
+    ap.add_argument('objs', nargs='+')
+    args = ap.parse_args()
+
+    regs = set(args.regs.split())
+    own = own_functions(args.objs)
+    start = re.compile(r'^[0-9a-f]+ <([^>]+)>:$')
+    insn = re.compile(r'^\s*([0-9a-f]+):\t(?:[0-9a-f]{2} )+\s*\t(\S+)\t?([^;]*)')
+    func = None
+    bad = {}
+
+    for line in run(OBJDUMP, '-d', args.elf).splitlines():
+        m = start.match(line)
+        if m:
+            func = m.group(1)
+            continue
+        m = insn.match(line)
+        if not m or func is None or func in own:
+            continue
+        used = regs & set(re.findall(r'\br\d+\b', m.group(3)))
+        if used:
+            bad.setdefault(func, []).append('%s: %s\t%s' %
+                                            (m.group(1), m.group(2),
+                                             m.group(3).strip()))
+
+    for func in sorted(bad):
+        print('%s touches reserved registers:' % func, file=sys.stderr)
+        for line in bad[func]:
+            print('  %s' % line, file=sys.stderr)
+    if bad:
+        sys.exit(1)
+    print('regcheck: %s untouched by library code' % ' '.join(sorted(regs)))
+
+
+if __name__ == '__main__':
+    main()
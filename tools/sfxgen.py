@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+#
+# sfxgen.py -- generate short square wave sound effects as raw
+#              8-bit unsigned PCM, ready for sndpack.py
+#
+# Usage:
+#   sfxgen.py -o coin.raw 988:80 1319:112
+#
+# Each NOTE is FREQ:MS, notes are played one after another.
+# The last note fades out linearly, as chip tunes do.
+#
+
+import argparse
+
+SAMPLE_RATE = 8000
+
+
+def parse_note(spec):
+    try:
+        freq, ms = spec.split(':')
+        return float(freq), int(ms)
+    except ValueError:
+        raise argparse.ArgumentTypeError("bad note '%s'" % spec)
+
+
+def square(freq, n, amplitude, fade):
+    out = bytearray()
+    period = SAMPLE_RATE / freq
+    for i in range(n):
+        amp = amplitude * (n - i) / n if fade else amplitude
+        s = amp if (i % period) < period / 2 else -amp
+        out.append(0x80 + int(round(s)))
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Generate square wave effect')
+    ap.add_argument('-o', '--output', required=True, help='raw pcm to write')
+    ap.add_argument('-a', '--amplitude', type=int, default=48,
+                    help='peak amplitude around 0x80, 1..127')
+    ap.add_argument('notes', nargs='+', type=parse_note, metavar='NOTE')
+    args = ap.parse_args()
+
+    pcm = bytearray()
+    for i, (freq, ms) in enumerate(args.notes):
+        n = SAMPLE_RATE * ms // 1000
+        pcm += square(freq, n, args.amplitude, i == len(args.notes) - 1)
+
+    with open(args.output, 'wb') as f:
+        f.write(pcm)
+
+
+if __name__ == '__main__':
+    main()
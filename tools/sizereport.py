@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+#
+# sizereport.py -- flash and RAM footprint of the firmware by section
+#                  and by symbol, compared with a stored baseline
+#
+# Usage:
+#   sizereport.py [-w] [-t BYTES] fedordesk.elf BASELINE
+#
+#   -w  write the current footprint as the new BASELINE
+#   -t  growth of flash or RAM tolerated before failing, bytes
+#
+# Sections come from avr-size -A, symbols from avr-nm -S. Flash is
+# .text plus .data initializers and the .assets bundle of
+# ASSET_BUNDLE=1, RAM is .data, .bss and .noinit.
+# Symbols which grew are marked with '+', new ones with '*'.
+# Exits with 1 when flash or RAM grew over the tolerance, so a
+# regression fails `make size-report`; after an intended change
+# store the new footprint with `make size-baseline`.
+#
+# BASELINE is plain text, one "section NAME SIZE" or
+# "symbol NAME SIZE" per line, so it diffs well under git.
+#
+
+import argparse
+import os
+import subprocess
+import sys
+
+FLASH_SIZE = 16384
+RAM_SIZE = 1024
+SECTIONS = ('.text', '.data', '.assets', '.bss', '.noinit', '.eeprom')
+NM = 'avr-nm'
+SIZE = 'avr-size'
+
+
+def run(*cmd):
+    return subprocess.run(cmd, check=True, stdout=subprocess.PIPE,
+                          universal_newlines=True).stdout
+
+
+def footprint(elf):
+    sections = {}
+    for line in run(SIZE, '-A', elf).splitlines():
+        words = line.split()
+        if len(words) == 3 and words[0] in SECTIONS:
+            sections[words[0]] = int(words[1])
+
+    symbols = {}
+    for line in run(NM, '-S', '--size-sort', elf).splitlines():
+        words = line.split()
+        if len(words) != 4:
+            continue
+        # static symbols of the same name in several files add up
+        symbols[words[3]] = symbols.get(words[3], 0) + int(words[1], 16)
+    return sections, symbols
+
+
+def load(path):
+    sections, symbols = {}, {}
+    with open(path) as f:
+        for line in f:
+            kind, name, size = line.split()
+            (sections if kind == 'section' else symbols)[name] = int(size)
+    return sections, symbols
+
+
+def save(path, sections, symbols):
+    with open(path, 'w') as f:
+        for name in SECTIONS:
+            if name in sections:
+                f.write('section %s %d\n' % (name, sections[name]))
+        for name, size in sorted(symbols.items(), key=lambda s: (-s[1], s[0])):
+            f.write('symbol %s %d\n' % (name, size))
+
+
+def totals(sections):
+    flash = sum(sections.get(s, 0) for s in ('.text', '.data', '.assets'))
+    ram = sum(sections.get(s, 0) for s in ('.data', '.bss', '.noinit'))
+    return flash, ram
+
+
+def delta(new, old):
+    if old is None:
+        return ''
+    return '%+d' % (new - old) if new != old else ''
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Firmware footprint report')
+    ap.add_argument('-w', '--write', action='store_true',
+                    help='store the current footprint as the baseline')
+    ap.add_argument('-t', '--tolerance', type=int, default=0)
+    ap.add_argument('elf')
+    ap.add_argument('baseline')
+    args = ap.parse_args()
+
+    sections, symbols = footprint(args.elf)
+    if args.write:
+        save(args.baseline, sections, symbols)
+        print('baseline %s written' % args.baseline)
+        return
+
+    if os.path.exists(args.baseline):
+        base_sections, base_symbols = load(args.baseline)
+    else:
+        print('no baseline %s, store one with make size-baseline' %
+              args.baseline)
+        base_sections, base_symbols = None, {}
+
+    print('%-28s %6s %8s' % ('section', 'size', 'delta'))
+    for name in SECTIONS:
+        if name in sections:
+            old = base_sections.get(name, 0) if base_sections else None
+            print('%-28s %6d %8s' % (name, sections[name],
+                                      delta(sections[name], old)))
+
+    flash, ram = totals(sections)
+    base_flash, base_ram = totals(base_sections) if base_sections else (None, None)
+    print('%-28s %6d %8s  %.1f%% of %d' % ('flash', flash,
+          delta(flash, base_flash), 100.0 * flash / FLASH_SIZE, FLASH_SIZE))
+    print('%-28s %6d %8s  %.1f%% of %d' % ('RAM', ram,
+          delta(ram, base_ram), 100.0 * ram / RAM_SIZE, RAM_SIZE))
+
+    print()
+    print('%-28s %6s %8s' % ('symbol', 'size', 'delta'))
+    for name, size in sorted(symbols.items(), key=lambda s: (-s[1], s[0])):
+        old = base_symbols.get(name)
+        mark = ''
+        if base_sections and old is None:
+            mark = '*'
+        elif old is not None and size > old:
+            mark = '+'
+        print('%-28s %6d %8s %s' % (name, size, delta(size, old), mark))
+    for name in sorted(set(base_symbols) - set(symbols)):
+        print('%-28s %6d %8s -' % (name, 0, delta(0, base_symbols[name])))
+
+    if base_sections and (flash - base_flash > args.tolerance or
+                          ram - base_ram > args.tolerance):
+        print('footprint regression: flash %+d, RAM %+d bytes' %
+              (flash - base_flash, ram - base_ram), file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,350 @@
+#!/usr/bin/env python3
+#
+# sndpack.py -- pack raw 8-bit unsigned PCM clips into one flash pool
+#               and generate sounddata.h for the firmware.
+#
+# Usage:
+#   sndpack.py -o sounddata.h [-n COLUMNSxLAYERS] [-f MS] CLIP [CLIP ...]
+#
+# CLIP is NAME=FILE[@OFFSET[+LENGTH]][,loop]
+#   NAME   - clip name, becomes CLIP_<NAME> index in the header
+#   FILE   - raw pcm, e.g. from
+#            $ sox file.mp3 -c1 -r8000 -e unsigned -b 8 out.raw
+#            or a mono 8kHz .wav of 8 or 16 bits
+#   OFFSET - first byte of the clip inside FILE
+#   LENGTH - clip length in bytes, till the end of FILE by default
+#   loop   - clip restarts from its beginning when finished
+#
+# Clips are deduplicated: a clip which is already a part of the pool
+# costs nothing, a clip whose head matches the tail of the pool adds
+# only the remaining bytes.
+#
+# The pool is also packed by the LZ block codec of lzpack.py, the
+# header has both, SAMPLES_LZ=1 takes the packed one. The ratio of
+# every clip is printed, blocks it spans and their seek table entries.
+#
+# Each clip gets cue points: its start and every note onset found in
+# it, i.e. places where playback can be resumed without cutting a note.
+#
+# Each clip also gets a beat map, led frames keyed to pool offsets,
+# shown when the sample ISR reaches them (BEAT_MAP=1), so nothing is
+# analysed on the chip:
+#   -n  led geometry, 12x3 by default, see tools/ledmap.py
+#   -f  flash length, ms, 100 by default
+# Every onset lights the column of its note, pitch class of 12
+# semitones spread over the columns, on the layer of its octave from
+# C4 up. Loud onsets light the whole layer, unpitched ones layer 0.
+# The frame goes dark after the flash length or at the next onset.
+# A clip starts with a dark frame, so a looped one restarts its map.
+#
+
+import argparse
+import math
+import re
+import sys
+import wave
+
+import lzpack
+
+
+class Clip:
+    def __init__(self, name, data, loop):
+        self.name = name
+        self.data = data
+        self.loop = loop
+        self.offset = None
+        self.cues = find_cues(data)
+        self.beats = None
+
+
+def read_pcm(path):
+    # 8-bit unsigned samples
+    if not path.lower().endswith('.wav'):
+        with open(path, 'rb') as f:
+            return f.read()
+    try:
+        with wave.open(path) as w:
+            if w.getnchannels() != 1 or w.getframerate() != SAMPLE_RATE or \
+               w.getsampwidth() not in (1, 2):
+                raise argparse.ArgumentTypeError(
+                    "'%s' is not 8 or 16 bit mono %dHz" % (path, SAMPLE_RATE))
+            width = w.getsampwidth()
+            data = w.readframes(w.getnframes())
+    except (OSError, wave.Error) as e:
+        raise argparse.ArgumentTypeError("'%s': %s" % (path, e))
+    if width == 1:
+        return data
+    # signed little endian, high bytes
+    return bytes((b + 0x80) & 0xff for b in data[1::2])
+
+
+def parse_geometry(spec):
+    m = re.match(r'^(\d+)x(\d+)$', spec)
+    if not m or not 0 < int(m.group(1)) <= 16 or not 0 < int(m.group(2)) <= 8:
+        raise argparse.ArgumentTypeError('geometry is COLUMNSxLAYERS, up to 16x8')
+    return int(m.group(1)), int(m.group(2))
+
+
+def parse_clip(spec):
+    m = re.match(r'^(\w+)=([^@,]+)(?:@(\d+)(?:\+(\d+))?)?((?:,\w+)*)$', spec)
+    if not m:
+        raise argparse.ArgumentTypeError("bad clip spec '%s'" % spec)
+    name, path, offset, length, flags = m.groups()
+    flags = [f for f in flags.split(',') if f]
+    for f in flags:
+        if f != 'loop':
+            raise argparse.ArgumentTypeError("unknown clip flag '%s'" % f)
+
+    data = read_pcm(path)
+    offset = int(offset or 0)
+    end = offset + int(length) if length else len(data)
+    if offset >= len(data) or end > len(data):
+        raise argparse.ArgumentTypeError("clip '%s' is out of '%s'" % (name, path))
+
+    return Clip(name.upper(), data[offset:end], 'loop' in flags)
+
+
+CUE_WINDOW = 64        # samples, 8ms
+CUE_MIN_LEVEL = 8      # peak to peak of an onset window
+CUE_RISE = 3           # onset is that many times louder than before
+CUE_MIN_DISTANCE = 1024
+
+SAMPLE_RATE = 8000
+BEAT_MIN_DISTANCE = 800  # 100ms
+BEAT_RISE = 2
+BEAT_LOUD = 0.75         # of the loudest onset of the clip
+PITCH_WINDOW = 512       # 64ms
+PITCH_MIN_HZ = 100
+PITCH_MAX_HZ = 2000
+PITCH_CLARITY = 0.3      # autocorrelation peak of a pitched note
+C4_HZ = 261.63
+
+
+def find_cues(data):
+    levels = [max(data[i:i + CUE_WINDOW]) - min(data[i:i + CUE_WINDOW])
+              for i in range(0, len(data), CUE_WINDOW)]
+    cues = [0]
+    for k, level in enumerate(levels):
+        before = max(levels[max(0, k - 2):k] or [0])
+        pos = k * CUE_WINDOW
+        if level >= CUE_MIN_LEVEL and level >= CUE_RISE * before and \
+           pos - cues[-1] >= CUE_MIN_DISTANCE:
+            cues.append(pos)
+    return cues
+
+
+def find_onsets(data):
+    levels = [max(data[i:i + CUE_WINDOW]) - min(data[i:i + CUE_WINDOW])
+              for i in range(0, len(data), CUE_WINDOW)]
+    onsets = []
+    for k, level in enumerate(levels):
+        before = max(levels[max(0, k - 2):k] or [0])
+        pos = k * CUE_WINDOW
+        if level >= CUE_MIN_LEVEL and level >= BEAT_RISE * before and \
+           (not onsets or pos - onsets[-1][0] >= BEAT_MIN_DISTANCE):
+            onsets.append((pos, level))
+    return onsets
+
+
+def pitch(data):
+    # autocorrelation peak over the note periods, None if unpitched
+    x = [b - 128 for b in data]
+    energy = sum(v * v for v in x)
+    if not energy:
+        return None
+    best, best_lag = 0, None
+    for lag in range(SAMPLE_RATE // PITCH_MAX_HZ, SAMPLE_RATE // PITCH_MIN_HZ + 1):
+        if lag >= len(x):
+            break
+        c = sum(x[i] * x[i + lag] for i in range(len(x) - lag)) / energy
+        if c > best:
+            best, best_lag = c, lag
+    if best < PITCH_CLARITY:
+        return None
+    return SAMPLE_RATE / best_lag
+
+
+def find_beats(data, columns, layers, flash):
+    # (offset, layer, leds) of the clip
+    onsets = find_onsets(data)
+    loudest = max([level for _, level in onsets] or [0])
+    beats = []
+    if not onsets or onsets[0][0]:
+        beats.append((0, 0, 0))
+    for k, (pos, level) in enumerate(onsets):
+        f = pitch(data[pos:pos + PITCH_WINDOW])
+        if f is None:
+            layer, leds = 0, (1 << columns) - 1
+        else:
+            note = round(12 * math.log2(f / C4_HZ))
+            layer = min(max(note // 12, 0), layers - 1)
+            leds = 1 << (note % 12 * columns // 12)
+            if level >= BEAT_LOUD * loudest:
+                leds = (1 << columns) - 1
+        beats.append((pos, layer, leds))
+        end = onsets[k + 1][0] if k + 1 < len(onsets) else len(data)
+        if pos + flash < end:
+            beats.append((pos + flash, layer, 0))
+    return beats
+
+
+def overlap(pool, data):
+    # longest tail of the pool which is a head of data
+    for k in range(min(len(pool), len(data) - 1), 0, -1):
+        if pool.endswith(data[:k]):
+            return k
+    return 0
+
+
+def pack(clips):
+    pool = bytearray()
+    # longest first, so shorter clips have a chance to be found inside
+    for clip in sorted(clips, key=lambda c: len(c.data), reverse=True):
+        pos = pool.find(clip.data)
+        if pos < 0:
+            k = overlap(pool, clip.data)
+            pos = len(pool) - k
+            pool += clip.data[k:]
+        clip.offset = pos
+    return bytes(pool)
+
+
+def c_array(data, indent='  ', per_line=12):
+    lines = []
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        lines.append(indent + ', '.join('0x%02x' % b for b in chunk))
+    return ',\n'.join(lines)
+
+
+def beat_table(clips):
+    # beats of a clip inside another one are shared, e.g. a looped
+    # phrase of the theme
+    table = []
+    for clip in sorted(clips, key=lambda c: len(c.data), reverse=True):
+        beats = [(clip.offset + pos, layer, leds)
+                 for pos, layer, leds in clip.beats]
+        if len(beats) > 255:
+            sys.exit('clip %s: %d beats, 255 at most' % (clip.name, len(beats)))
+        for i in range(len(table) - len(beats) + 1):
+            if table[i:i + len(beats)] == beats:
+                clip.beat = i
+                break
+        else:
+            clip.beat = len(table)
+            table += beats
+    return table
+
+
+def generate(clips, pool, packed, blocks, cmdline):
+    out = []
+    out.append('#ifndef SOUNDDATA_H')
+    out.append('#define SOUNDDATA_H')
+    out.append('')
+    out.append('// get Super Mario Bros. theme:')
+    out.append('//   http://www.supermariobrothers.org/music/smb-overworld.mp3')
+    out.append('// convert mp3 to raw pcm:')
+    out.append('//   $ sox file.mp3 -c1 -r8000 -e unsigned -b 8 out.raw')
+    out.append('// get only 14 kbytes:')
+    out.append('//   $ dd if=out.raw of=theme.raw count=14 bs=1024')
+    out.append('// generate coin effect:')
+    out.append('//   $ sfxgen.py -o coin.raw 988:80 1319:112')
+    out.append('// generate C header:')
+    out.append('//   $ %s' % cmdline)
+    out.append('')
+    out.append('#include <avr/pgmspace.h>')
+    out.append('')
+    out.append('#include "sound.h"')
+    out.append('')
+    for i, clip in enumerate(clips):
+        out.append('#define CLIP_%-10s %d' % (clip.name, i))
+    out.append('#define CLIPS_NUM       %d' % len(clips))
+    out.append('')
+    out.append('#if SAMPLES_LZ')
+    out.append('// pool of %d bytes, packed, see lz.h' % len(pool))
+    out.append('const unsigned char s_lz[] PROGMEM = {')
+    out.append(c_array(packed))
+    out.append('};')
+    out.append('')
+    out.append('const uint16_t s_lz_blocks[] PROGMEM = {')
+    for i in range(0, len(blocks), 8):
+        out.append('\t' + ' '.join('%5d,' % b for b in blocks[i:i + 8]))
+    out.append('};')
+    out.append('#else')
+    out.append('const unsigned char s_samples[] PROGMEM = {')
+    out.append(c_array(pool))
+    out.append('};')
+    out.append('#endif')
+    out.append('')
+    out.append('const uint16_t s_cues[] PROGMEM = {')
+    cue = 0
+    for clip in clips:
+        out.append('\t%s, // %s' % (', '.join('%5d' % (clip.offset + c)
+                                              for c in clip.cues),
+                                    clip.name.lower()))
+        clip.cue = cue
+        cue += len(clip.cues)
+    out.append('};')
+    out.append('')
+    out.append('const beat_t s_beats[] PROGMEM = {')
+    table = beat_table(clips)
+    for i in range(0, len(table), 4):
+        out.append('\t' + ' '.join('{ %5d, %d, 0x%04x },' % beat
+                                   for beat in table[i:i + 4]))
+    out.append('};')
+    out.append('')
+    out.append('const clip_t s_clips[CLIPS_NUM] PROGMEM = {')
+    for clip in clips:
+        flags = 'CLIP_LOOP' if clip.loop else '0'
+        out.append('\t{ .offset = %5d, .length = %5d, .cue = %2d, .cues_num = %d, '
+                   '.beat = %3d, .beats_num = %2d, .flags = %s }, // %s' %
+                   (clip.offset, len(clip.data), clip.cue, len(clip.cues),
+                    clip.beat, len(clip.beats), flags, clip.name.lower()))
+    out.append('};')
+    out.append('')
+    out.append('#endif //SOUNDDATA_H')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Pack PCM clips into sounddata.h')
+    ap.add_argument('-o', '--output', required=True, help='header to generate')
+    ap.add_argument('-n', '--geometry', default='12x3', type=parse_geometry,
+                    help='led COLUMNSxLAYERS of beat maps')
+    ap.add_argument('-f', '--flash', type=int, default=100,
+                    help='beat flash length, ms')
+    ap.add_argument('clips', nargs='+', type=parse_clip, metavar='CLIP')
+    args = ap.parse_args()
+
+    for clip in args.clips:
+        clip.beats = find_beats(clip.data, *args.geometry,
+                                args.flash * SAMPLE_RATE // 1000)
+
+    pool = pack(args.clips)
+    if len(pool) > 0xffff:
+        sys.exit('pool is too big: %d bytes' % len(pool))
+
+    total = sum(len(c.data) for c in args.clips)
+    print('%d clips, %d bytes, pool %d bytes (%d saved), %d beats' %
+          (len(args.clips), total, len(pool), total - len(pool),
+           sum(len(c.beats) for c in args.clips)), file=sys.stderr)
+
+    packed, blocks = lzpack.pack(pool)
+    if lzpack.unpack(packed, blocks, len(pool)) != pool:
+        sys.exit('packed pool does not unpack')
+    for clip in args.clips:
+        size = lzpack.packed_size(blocks, packed, clip.offset, len(clip.data))
+        print('  %-10s %5d -> %5d bytes, %d%%' %
+              (clip.name.lower(), len(clip.data), size,
+               100 * size // len(clip.data)), file=sys.stderr)
+    size = len(packed) + 2 * len(blocks)
+    print('  %-10s %5d -> %5d bytes, %d%%' %
+          ('pool', len(pool), size, 100 * size // len(pool)), file=sys.stderr)
+
+    cmdline = ' '.join(['sndpack.py'] + sys.argv[1:])
+    with open(args.output, 'w') as f:
+        f.write(generate(args.clips, pool, packed, blocks, cmdline))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+#
+# stackcheck.py -- static worst case stack depth of the firmware,
+#                  fails if it is over budget
+#
+# Usage:
+#   stackcheck.py [-b BUDGET] [-v] fedordesk.elf FILE.su [FILE.su ...]
+#
+# Frame sizes come from avr-gcc -fstack-usage (.su files), the call
+# graph from avr-objdump -d of the elf. Every call pushes a 2 byte
+# return address, so does an interrupt.
+#
+# Worst case is the deepest main() path plus the deepest interrupt
+# vector on top of it: ISRs don't nest, there is no ISR_NOBLOCK.
+# Indirect calls (icall) may go to any of ICALL_TARGETS: the led
+# callback passed to desk_init_leds() and main loop tasks of sched.c.
+# Functions without .su, i.e. libgcc and avr-libc assembly, are
+# counted with no frame of their own.
+#
+# Fails when the worst case is over BUDGET or over RAM left by
+# .data, .bss and .noinit, when the call graph has a cycle or when
+# a frame is dynamic.
+#
+
+import argparse
+import re
+import subprocess
+import sys
+
+RAM_START = 0x60
+RAM_END = 0x45f
+RETURN_ADDR = 2
+ICALL_TARGETS = ['leds_show', 'anim_task', 'debounce_task', 'save_task',
+                 'telemetry_task', 'spectrum_task', 'beat_task']
+OBJDUMP = 'avr-objdump'
+SIZE = 'avr-size'
+
+
+def base_name(name):
+    # optimized clones, e.g. foo.constprop.0, foo.isra.0
+    return name.split('.')[0]
+
+
+def read_su(paths):
+    frames = {}
+    dynamic = []
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                where, size, kind = line.rstrip('\n').split('\t')
+                name = base_name(where.rsplit(':', 1)[1])
+                frames[name] = max(frames.get(name, 0), int(size))
+                if kind.startswith('dynamic'):
+                    dynamic.append(name)
+    return frames, dynamic
+
+
+def call_graph(elf):
+    out = subprocess.run([OBJDUMP, '-d', elf], check=True,
+                         stdout=subprocess.PIPE, universal_newlines=True).stdout
+    graph = {}
+    func = None
+    start = re.compile(r'^[0-9a-f]+ <([^>]+)>:$')
+    call = re.compile(r'\t(r?call|r?jmp)\t.*<([^>+]+)>$')
+    for line in out.splitlines():
+        m = start.match(line)
+        if m:
+            func = base_name(m.group(1))
+            graph.setdefault(func, set())
+            continue
+        if func is None:
+            continue
+        m = call.search(line)
+        if m:
+            # jumps inside the function are not calls
+            target = base_name(m.group(2))
+            if target != func:
+                graph[func].add((target, m.group(1).endswith('call')))
+        elif '\ticall' in line or '\teicall' in line:
+            for target in ICALL_TARGETS:
+                graph[func].add((target, True))
+    return graph
+
+
+def depth(func, graph, frames, path, memo):
+    if func in memo:
+        return memo[func]
+    if func in path:
+        sys.exit('recursion: %s' % ' -> '.join(path + [func]))
+    worst, worst_path = 0, []
+    for target, is_call in graph.get(func, ()):
+        d, p = depth(target, graph, frames, path + [func], memo)
+        # tail jump reuses the caller return address
+        d += RETURN_ADDR if is_call else 0
+        if d > worst:
+            worst, worst_path = d, p
+    memo[func] = (frames.get(func, 0) + worst, [func] + worst_path)
+    return memo[func]
+
+
+def ram_used(elf):
+    out = subprocess.run([SIZE, '-A', elf], check=True,
+                         stdout=subprocess.PIPE, universal_newlines=True).stdout
+    used = 0
+    for line in out.splitlines():
+        words = line.split()
+        if words and words[0] in ('.data', '.bss', '.noinit'):
+            used += int(words[1])
+    return used
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Check worst case stack depth')
+    ap.add_argument('-b', '--budget', type=int, default=0,
+                    help='max stack bytes, RAM left by variables if 0')
+    ap.add_argument('-v', '--verbose', action='store_true',
+                    help='print the worst path of every root')
+    ap.add_argument('elf')
+    ap.add_argument('su', nargs='+')
+    args = ap.parse_args()
+
+    frames, dynamic = read_su(args.su)
+    graph = call_graph(args.elf)
+    memo = {}
+
+    if dynamic:
+        sys.exit('dynamic stack frames: %s' % ', '.join(sorted(set(dynamic))))
+
+    main_depth, main_path = depth('main', graph, frames, [], memo)
+    isr_depth, isr_path = 0, []
+    for func in sorted(graph):
+        if not func.startswith('__vector_'):
+            continue
+        d, p = depth(func, graph, frames, [], memo)
+        d += RETURN_ADDR
+        if args.verbose:
+            print('%-12s %4d  %s' % (func, d, ' -> '.join(p)))
+        if d > isr_depth:
+            isr_depth, isr_path = d, p
+    if args.verbose:
+        print('%-12s %4d  %s' % ('main', main_depth, ' -> '.join(main_path)))
+
+    worst = main_depth + isr_depth
+    free = RAM_END + 1 - RAM_START - ram_used(args.elf)
+    budget = min(args.budget, free) if args.budget else free
+
+    print('stack: worst %d bytes (main %d + %s %d), budget %d, RAM free %d' %
+          (worst, main_depth, isr_path[0] if isr_path else 'no ISR',
+           isr_depth, budget, free))
+    if worst > budget:
+        print('stack: over budget by %d bytes: %s, then %s' %
+              (worst - budget, ' -> '.join(main_path), ' -> '.join(isr_path)),
+              file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
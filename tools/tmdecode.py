@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+#
+# tmdecode.py -- decode firmware telemetry (make TELEMETRY=1)
+#
+# Usage:
+#   tmdecode.py [-b BAUD] PORT|FILE
+#
+# PORT is a serial device or the pty printed by sim/fedorsim -u,
+# FILE is a capture of the TX line. Record format is described in
+# src/telemetry.h, XON/XOFF and garbage between records are skipped.
+#
+
+import argparse
+import os
+import stat
+import time
+
+# enum tm_type in src/telemetry.h
+TYPES = [
+    'boot',
+    'button',
+    'mode',
+    'speed',
+    'isr_overruns',
+    'underruns',
+    'rx_overruns',
+    'stack_free',
+    'dropped',
+]
+
+RECORD = 4
+
+
+class Decoder:
+    def __init__(self):
+        self.record = []
+
+    # yields (type name, value) for complete records
+    def feed(self, data):
+        for b in data:
+            if b & 0xc0 == 0x80:
+                # record start, drops unfinished one
+                self.record = [b]
+            elif b & 0xc0 == 0xc0 and self.record:
+                self.record.append(b)
+                if len(self.record) == RECORD:
+                    yield self.decode(self.record)
+                    self.record = []
+            elif b & 0x80:
+                # continuation without start
+                self.record = []
+            # else flow control, may be sent in the middle of a record
+
+    @staticmethod
+    def decode(r):
+        t = r[0] & 0x3f
+        value = (r[1] & 0x3f) | (r[2] & 0x3f) << 6 | (r[3] & 0x0f) << 12
+        name = TYPES[t] if t < len(TYPES) else 'type%d' % t
+        return name, value
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Decode FedorDesk telemetry')
+    ap.add_argument('-b', '--baud', type=int, default=250000)
+    ap.add_argument('source', help='serial port or capture file')
+    args = ap.parse_args()
+
+    dec = Decoder()
+    port = stat.S_ISCHR(os.stat(args.source).st_mode)
+    if port:
+        import serial
+        src = serial.Serial(args.source, args.baud, timeout=0.1)
+    else:
+        src = open(args.source, 'rb')
+
+    start = time.monotonic()
+    while True:
+        data = src.read(64)
+        # end of capture file, port is read forever
+        if not data and not port:
+            break
+        for name, value in dec.feed(data):
+            print('%9.3f %-13s %u' % (time.monotonic() - start, name, value),
+                  flush=True)
+
+
+if __name__ == '__main__':
+    main()
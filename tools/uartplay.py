@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+# uartplay.py -- stream pcm to the firmware over USART (make UART_STREAM=1)
+#
+# Usage:
+#   uartplay.py [-b BAUD] PORT FILE
+#
+# PORT is a serial device, e.g. /dev/ttyUSB0, or the pty printed by
+# sim/fedorsim -u. FILE is a .wav (mono 8-bit 8kHz) or raw 8-bit
+# unsigned 8kHz pcm, '-' reads raw pcm from stdin:
+#   $ sox song.mp3 -t raw -c1 -r8000 -e unsigned -b 8 - | uartplay.py PORT -
+#
+# Data is paced to the sample rate with a small lead, firmware
+# throttles it further with XOFF/XON when its jitter buffer fills.
+# With -t telemetry records (make TELEMETRY=1) are printed too.
+#
+
+import argparse
+import sys
+import time
+import wave
+
+import serial
+
+from tmdecode import Decoder
+
+SAMPLE_RATE = 8000
+XON = 0x11
+XOFF = 0x13
+CHUNK = 32
+# how far ahead of real time we may be, firmware buffer is 256 bytes
+LEAD = 192
+
+
+def open_pcm(path):
+    if path == '-':
+        return sys.stdin.buffer
+    if path.endswith('.wav'):
+        w = wave.open(path, 'rb')
+        if w.getnchannels() != 1 or w.getsampwidth() != 1 or \
+           w.getframerate() != SAMPLE_RATE:
+            sys.exit('%s: need mono 8-bit %dHz' % (path, SAMPLE_RATE))
+
+        class Reader:
+            def read(self, n):
+                return w.readframes(n)
+        return Reader()
+    return open(path, 'rb')
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Stream pcm to FedorDesk')
+    ap.add_argument('-b', '--baud', type=int, default=250000)
+    ap.add_argument('-t', '--telemetry', action='store_true',
+                    help='print telemetry records')
+    ap.add_argument('port')
+    ap.add_argument('file')
+    args = ap.parse_args()
+
+    port = serial.Serial(args.port, args.baud, timeout=0)
+    pcm = open_pcm(args.file)
+
+    dec = Decoder()
+    paused = False
+    sent = 0
+    xoffs = 0
+    start = time.monotonic()
+    while True:
+        data = port.read(port.in_waiting or 1)
+        if args.telemetry:
+            for name, value in dec.feed(data):
+                print('%9.3f %-13s %u' % (time.monotonic() - start, name, value),
+                      file=sys.stderr)
+        for b in data:
+            if b == XOFF:
+                paused = True
+                xoffs += 1
+            elif b == XON:
+                paused = False
+
+        played = (time.monotonic() - start) * SAMPLE_RATE
+        if paused or sent - played >= LEAD:
+            time.sleep(CHUNK / SAMPLE_RATE / 2)
+            continue
+
+        chunk = pcm.read(CHUNK)
+        if not chunk:
+            break
+        port.write(chunk)
+        sent += len(chunk)
+
+    port.flush()
+    print('%d bytes, %.1fs, %d XOFF' % (sent, sent / SAMPLE_RATE, xoffs),
+          file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()